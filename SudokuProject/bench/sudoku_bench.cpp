@@ -0,0 +1,666 @@
+/**
+ * @file sudoku_bench.cpp
+ * @brief Solver benchmark over fixed seeded corpora with machine-readable output.
+ *
+ * Every solver backend is timed on four corpora:
+ * - `easy`, `medium`, `hard`: unique puzzles from generateBoardWithDifficulty(),
+ *   drawn from fixed Rng seeds, so every machine benchmarks the same puzzles;
+ * - `17clue`: minimal 17-clue puzzles, expanded from a fixed list by seeded
+ *   validity-preserving transformations (digit relabelling, row/column
+ *   swaps within bands and stacks, band/stack swaps, transposition).
+ * Corpora are cached as binary corpus files (see corpus.h) in the corpus
+ * directory, so they are generated only once, and loaded into a packed
+ * PuzzleSet (41 bytes per puzzle and 41 per solution, see puzzle_set.h).
+ *
+ * For each corpus and backend the puzzles are solved round-robin, first for a
+ * warm-up period and then for a fixed measuring period. Every call is timed
+ * and checked against the stored solution. The report gives the p50, p90,
+ * p99, max and mean call latency and the throughput in puzzles per second.
+ * The `batch` backend solves BATCH_LANES puzzles per call, so its latencies
+ * are per batch (see `puzzles_per_call`). A separate, untimed pass over the
+ * first puzzles of the corpus adds the hardware-independent search counters
+ * of solver_stats.h (nodes and backtracks per puzzle, maximum depth).
+ * With `--cache`, every backend solves through a SolutionCache, so replaying
+ * the corpus measures the cached path and the report adds its hits and misses.
+ *
+ * Results are written as JSON (one result object per line) or CSV. With
+ * `--compare`, the results are diffed against a baseline written earlier in
+ * either format, and the exit code is 2 if any run regressed by more than
+ * the threshold or its node count changed by more than the threshold.
+ *
+ * @author
+ * Keshav Bhandari
+ *
+ * @date
+ * October 16, 2026
+ */
+
+#include "../include/batch_solver.h"
+#include "../include/board.h"
+#include "../include/canonical.h"
+#include "../include/corpus.h"
+#include "../include/generator.h"
+#include "../include/puzzle_set.h"
+#include "../include/rater.h"
+#include "../include/rng.h"
+#include "../include/solution_cache.h"
+#include "../include/sudoku.h"
+#include "../include/thread_pool.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace std;
+using Clock = chrono::steady_clock;
+
+static const uint64_t BENCH_SEED = 20261016;
+
+/**
+ * @brief Command line options of the benchmark.
+ */
+struct BenchOptions {
+    string corpus_dir = "bench_corpora";
+    int corpus_size = 1000;
+    double seconds = 2.0;
+    double warmup = 0.5;
+    vector<string> corpora = {"easy", "medium", "hard", "17clue"};
+    vector<string> solvers = {"backtracking", "efficient", "dlx", "batch"};
+    string format = "json";
+    string output;
+    string baseline;
+    double threshold = 10.0;
+    int stats_puzzles = 32;
+    int cache = 0;
+    bool regenerate = false;
+};
+
+/**
+ * @brief Puzzles of one corpus with their solutions, packed.
+ */
+struct BenchCorpus {
+    string name;
+    PuzzleSet set{CellLayout::Packed, PUZZLE_SET_SOLUTIONS};
+    vector<PuzzleBlock> blocks;   // Views of `set`, taken once it is loaded
+
+    size_t size() const { return set.size(); }
+
+    // Unpacks puzzle `index` from its block
+    void puzzle(const size_t& index, Board& board) const {
+        const PuzzleBlock& block = blocks[index / PUZZLE_SET_CHUNK];
+        unpackBoard(block.packedPuzzles + (index % PUZZLE_SET_CHUNK) * PACKED_BOARD_SIZE, board);
+    }
+
+    // Compares a board with the stored solution of puzzle `index` in packed form
+    bool isSolution(const size_t& index, const Board& board) const {
+        const PuzzleBlock& block = blocks[index / PUZZLE_SET_CHUNK];
+        uint8_t packed[PACKED_BOARD_SIZE];
+        packBoard(board, packed);
+        return memcmp(packed, block.packedSolutions + (index % PUZZLE_SET_CHUNK) * PACKED_BOARD_SIZE,
+                      PACKED_BOARD_SIZE) == 0;
+    }
+};
+
+/**
+ * @brief A solver backend: solves `count` boards in place per call.
+ */
+struct Backend {
+    string name;
+    int puzzles_per_call;
+    function<void(Board*, int)> run;
+    function<void(Board*, int, SolverStats&)> instrumented;
+};
+
+/**
+ * @brief Measurements of one backend on one corpus.
+ */
+struct BenchResult {
+    string corpus;
+    string solver;
+    int puzzles_per_call = 1;
+    uint64_t calls = 0;
+    uint64_t failures = 0;
+    double p50 = 0, p90 = 0, p99 = 0, max = 0, mean = 0;  // Microseconds per call
+    double throughput = 0;                                // Puzzles per second
+    double nodes = 0;                                     // Search nodes per puzzle
+    double backtracks = 0;                                // Backtracks per puzzle
+    int max_depth = 0;
+    uint64_t cache_hits = 0;                              // With --cache, over the warm-up and the timed run
+    uint64_t cache_misses = 0;
+};
+
+// Minimal puzzles from the published 17-clue collection
+static const char* const SEVENTEEN_CLUE_PUZZLES[] = {
+    "000000010400000000020000000000050407008000300001090000300400200050100000000806000",
+    "000000010400000000020000000000050604008000300001090000300400200050100000000807000",
+    "000000012000035000000600070700000300000400800100000000000120000080000040050000600",
+    "000000012003600000000007000410020000000500300700000600280000040000300500000000000",
+    "000000012008030000000000040120500000000004700060000000507000300000620000000100000",
+    "000000012040050000000009000070600400000100000000000050000087500601000300200000000",
+    "000000012050400000000000030700600400001000000000080000920000800000510700000003000",
+    "000000013000030080070000000000206000030000900000010000600500204000400700100000000",
+    "000000013000500070000802000000400900107000000000000200890000050040000600000010000",
+    "000000013020500000000000000103000070000802000004000000000340500670000200000010000",
+};
+
+// ========================= Corpora ==========================
+
+/**
+ * @brief Returns a random member of the equivalence class of a puzzle.
+ *
+ * The transformations map valid grids to valid grids, so clue count and
+ * uniqueness are preserved.
+ */
+static Board randomIsomorph(const Board& board, Rng& rng) {
+    return applyTransform(board, randomTransform(rng));
+}
+
+/**
+ * @brief Generates a corpus from its fixed seed.
+ *
+ * @return true on success, false if the corpus name is unknown or generation failed.
+ */
+static bool generateCorpus(const string& name, const int& size, vector<Board>& puzzles, vector<Board>& solutions) {
+    static const map<string, Difficulty> BANDS = {
+        {"easy", Difficulty::Easy}, {"medium", Difficulty::Medium}, {"hard", Difficulty::Hard}};
+
+    puzzles.clear();
+    solutions.clear();
+    if (name == "17clue") {
+        Rng rng(BENCH_SEED, 3);
+        const int base_count = sizeof(SEVENTEEN_CLUE_PUZZLES) / sizeof(SEVENTEEN_CLUE_PUZZLES[0]);
+        for (int i = 0; i < size; i++) {
+            Board base;
+            for (int j = 0; j < 81; j++) base[j] = static_cast<uint8_t>(SEVENTEEN_CLUE_PUZZLES[i % base_count][j] - '0');
+            puzzles.push_back(i < base_count ? base : randomIsomorph(base, rng));
+        }
+    } else {
+        const auto band = BANDS.find(name);
+        if (band == BANDS.end()) {
+            cerr << "Unknown corpus: " << name << endl;
+            return false;
+        }
+        Rng rng(BENCH_SEED, static_cast<uint64_t>(band->second));
+        for (int i = 0; i < size; i++) {
+            Board puzzle;
+            if (!generateBoardWithDifficulty(puzzle, band->second, rng)) {
+                cerr << "Unable to generate a " << name << " puzzle" << endl;
+                return false;
+            }
+            puzzles.push_back(puzzle);
+        }
+    }
+
+    for (const Board& puzzle : puzzles) {
+        Board solution = puzzle;
+        if (!solveBoardEfficient(solution)) {
+            cerr << "Corpus " << name << " contains an unsolvable puzzle" << endl;
+            return false;
+        }
+        solutions.push_back(solution);
+    }
+    return true;
+}
+
+/**
+ * @brief Loads a corpus from the cache directory, generating and caching it if needed.
+ */
+static bool loadCorpus(const string& name, const BenchOptions& options, BenchCorpus& corpus) {
+    corpus.name = name;
+    corpus.set.clear();
+    const string filename = options.corpus_dir + "/" + name + ".sdkc";
+
+    bool cached = false;
+    if (!options.regenerate && filesystem::exists(filename)) {
+        CorpusReader reader;
+        cached = reader.open(filename) && reader.hasSolutions() &&
+                 reader.size() == static_cast<uint64_t>(options.corpus_size);
+    }
+
+    if (cached) {
+        if (!loadPuzzleSet(filename, corpus.set)) return false;
+    } else {
+        cerr << "Generating corpus " << name << " (" << options.corpus_size << " puzzles)..." << endl;
+        vector<Board> puzzles, solutions;
+        if (!generateCorpus(name, options.corpus_size, puzzles, solutions)) return false;
+
+        error_code error;
+        filesystem::create_directories(options.corpus_dir, error);
+        if (!writeCorpus(filename, puzzles, &solutions)) {
+            cerr << "Corpus " << name << " is not cached and will be generated again next time" << endl;
+        }
+        for (size_t i = 0; i < puzzles.size(); i++) corpus.set.setSolution(corpus.set.add(puzzles[i]), solutions[i]);
+    }
+
+    corpus.blocks.clear();
+    for (size_t b = 0; b < corpus.set.blockCount(); b++) corpus.blocks.push_back(corpus.set.block(b));
+    return true;
+}
+
+// ========================= Measurement ==========================
+
+static Backend scalarBackend(const string& name, const SolverType& solver) {
+    return {name, 1,
+            [solver](Board* boards, int count) {
+                for (int i = 0; i < count; i++) solve(boards[i], solver);
+            },
+            [solver](Board* boards, int count, SolverStats& stats) {
+                for (int i = 0; i < count; i++) solve(boards[i], solver, stats);
+            }};
+}
+
+// Shared by every call of the parallel backend, so the timings leave out starting and joining threads
+static ThreadPool& parallelPool() {
+    static ThreadPool pool;
+    return pool;
+}
+
+static vector<Backend> allBackends() {
+    return {
+        scalarBackend("backtracking", SolverType::Backtracking),
+        scalarBackend("efficient", SolverType::Efficient),
+        scalarBackend("dlx", SolverType::DancingLinks),
+        {"batch", BATCH_LANES, [](Board* boards, int count) { solveBoardsBatch(boards, count); },
+         [](Board* boards, int count, SolverStats& stats) { solveBoardsBatch(boards, count, nullptr, &stats); }},
+        // One puzzle at a time on every hardware thread; not in the default list, and it reports no search counters
+        {"parallel", 1, [](Board* boards, int) { solveBoardParallel(boards[0], parallelPool()); },
+         [](Board* boards, int, SolverStats&) { solveBoardParallel(boards[0], parallelPool()); }},
+    };
+}
+
+/**
+ * @brief Runs a backend through a solution cache; the misses of a call are still solved together.
+ *
+ * The instrumented pass bypasses the cache, so the search counters stay those of the backend.
+ */
+static Backend cachedBackend(const Backend& backend, SolutionCache& cache) {
+    Backend cached = backend;
+    cached.name = backend.name + "+cache";
+    cached.run = [backend, &cache](Board* boards, int count) {
+        solveThroughCache(boards, count, nullptr, cache, [&backend](Board* misses, int n, bool* solved) {
+            backend.run(misses, n);
+            for (int i = 0; i < n; i++) {
+                solved[i] = true;
+                for (int j = 0; j < 81; j++) solved[i] = solved[i] && misses[i][j] != 0;
+            }
+        });
+    };
+    return cached;
+}
+
+// Nearest-rank percentile of sorted samples
+static double percentile(const vector<double>& sorted, const double& p) {
+    if (sorted.empty()) return 0;
+    const size_t rank = static_cast<size_t>(ceil(p * static_cast<double>(sorted.size())));
+    return sorted[rank > 0 ? rank - 1 : 0];
+}
+
+/**
+ * @brief Solves the corpus round-robin with one backend for a period of time.
+ *
+ * At least one call is made. Only the solver call is timed; copying the
+ * puzzles in and checking the solutions happen outside the timed region.
+ *
+ * @param samples Receives the latency of every call in microseconds (may be nullptr).
+ * @param failures Incremented for every puzzle not solved to its stored solution.
+ * @return double The elapsed wall time in seconds.
+ */
+static double runFor(const Backend& backend, const BenchCorpus& corpus, const double& seconds,
+                     vector<double>* samples, uint64_t& failures, uint64_t& calls) {
+    const size_t n = corpus.size();
+    vector<Board> work(backend.puzzles_per_call);
+    size_t next = 0;
+
+    const Clock::time_point start = Clock::now();
+    const Clock::time_point deadline = start + chrono::duration_cast<Clock::duration>(chrono::duration<double>(seconds));
+    Clock::time_point now;
+    do {
+        for (int j = 0; j < backend.puzzles_per_call; j++) corpus.puzzle((next + j) % n, work[j]);
+
+        const Clock::time_point t0 = Clock::now();
+        backend.run(work.data(), backend.puzzles_per_call);
+        now = Clock::now();
+
+        if (samples) samples->push_back(chrono::duration<double, micro>(now - t0).count());
+        for (int j = 0; j < backend.puzzles_per_call; j++) {
+            if (!corpus.isSolution((next + j) % n, work[j])) failures++;
+        }
+        calls++;
+        next = (next + backend.puzzles_per_call) % n;
+    } while (now < deadline);
+
+    return chrono::duration<double>(now - start).count();
+}
+
+static BenchResult benchmark(const Backend& backend, const BenchCorpus& corpus, const BenchOptions& options) {
+    BenchResult result;
+    result.corpus = corpus.name;
+    result.solver = backend.name;
+    result.puzzles_per_call = backend.puzzles_per_call;
+
+    uint64_t warmup_failures = 0, warmup_calls = 0;
+    if (options.warmup > 0) runFor(backend, corpus, options.warmup, nullptr, warmup_failures, warmup_calls);
+
+    vector<double> samples;
+    samples.reserve(1 << 16);
+    const double elapsed = runFor(backend, corpus, options.seconds, &samples, result.failures, result.calls);
+
+    double total = 0;
+    for (const double& sample : samples) total += sample;
+    sort(samples.begin(), samples.end());
+    result.p50 = percentile(samples, 0.50);
+    result.p90 = percentile(samples, 0.90);
+    result.p99 = percentile(samples, 0.99);
+    result.max = samples.back();
+    result.mean = total / static_cast<double>(samples.size());
+    result.throughput = static_cast<double>(result.calls * backend.puzzles_per_call) / elapsed;
+
+    // Search counters of a fixed prefix of the corpus, outside the timed runs
+    SolverStats stats;
+    const int stats_count = min(options.stats_puzzles, static_cast<int>(corpus.size()));
+    vector<Board> work(stats_count);
+    for (int i = 0; i < stats_count; i++) corpus.puzzle(static_cast<size_t>(i), work[i]);
+    for (int first = 0; first < stats_count; first += backend.puzzles_per_call) {
+        backend.instrumented(work.data() + first, min(backend.puzzles_per_call, stats_count - first), stats);
+    }
+    if (stats.puzzles > 0) {
+        result.nodes = static_cast<double>(stats.nodes) / static_cast<double>(stats.puzzles);
+        result.backtracks = static_cast<double>(stats.backtracks) / static_cast<double>(stats.puzzles);
+    }
+    result.max_depth = stats.maxDepth;
+    return result;
+}
+
+// ========================= Reports ==========================
+
+static void writeJson(ostream& out, const vector<BenchResult>& results, const BenchOptions& options) {
+    out << fixed << setprecision(3);
+    out << "{\n";
+    out << "  \"benchmark\": \"sudoku_bench\",\n";
+    out << "  \"batch_kernel\": \"" << getBatchKernelName() << "\",\n";
+    out << "  \"corpus_size\": " << options.corpus_size << ",\n";
+    out << "  \"seconds\": " << options.seconds << ",\n";
+    out << "  \"warmup\": " << options.warmup << ",\n";
+    out << "  \"results\": [\n";
+    for (size_t i = 0; i < results.size(); i++) {
+        const BenchResult& r = results[i];
+        out << "    {\"corpus\": \"" << r.corpus << "\", \"solver\": \"" << r.solver
+            << "\", \"puzzles_per_call\": " << r.puzzles_per_call << ", \"calls\": " << r.calls
+            << ", \"failures\": " << r.failures << ", \"p50_us\": " << r.p50 << ", \"p90_us\": " << r.p90
+            << ", \"p99_us\": " << r.p99 << ", \"max_us\": " << r.max << ", \"mean_us\": " << r.mean
+            << ", \"throughput\": " << r.throughput << ", \"nodes\": " << r.nodes << ", \"backtracks\": "
+            << r.backtracks << ", \"max_depth\": " << r.max_depth << ", \"cache_hits\": " << r.cache_hits
+            << ", \"cache_misses\": " << r.cache_misses << "}" << (i + 1 < results.size() ? "," : "")
+            << "\n";
+    }
+    out << "  ]\n";
+    out << "}\n";
+}
+
+static void writeCsv(ostream& out, const vector<BenchResult>& results) {
+    out << fixed << setprecision(3);
+    out << "corpus,solver,puzzles_per_call,calls,failures,p50_us,p90_us,p99_us,max_us,mean_us,throughput,nodes,"
+           "backtracks,max_depth,cache_hits,cache_misses\n";
+    for (const BenchResult& r : results) {
+        out << r.corpus << "," << r.solver << "," << r.puzzles_per_call << "," << r.calls << "," << r.failures
+            << "," << r.p50 << "," << r.p90 << "," << r.p99 << "," << r.max << "," << r.mean << ","
+            << r.throughput << "," << r.nodes << "," << r.backtracks << "," << r.max_depth << "," << r.cache_hits
+            << "," << r.cache_misses << "\n";
+    }
+}
+
+// Value of `"key": value` in a JSON result line (quotes stripped), or "" if absent
+static string jsonField(const string& line, const string& key) {
+    const string pattern = "\"" + key + "\":";
+    size_t pos = line.find(pattern);
+    if (pos == string::npos) return "";
+    pos = line.find_first_not_of(" \"", pos + pattern.size());
+    if (pos == string::npos) return "";
+    const size_t end = line.find_first_of(",}\"", pos);
+    return line.substr(pos, end == string::npos ? string::npos : end - pos);
+}
+
+static BenchResult resultFromFields(const map<string, string>& fields) {
+    auto number = [&](const string& key) {
+        const auto it = fields.find(key);
+        return it == fields.end() ? 0.0 : atof(it->second.c_str());
+    };
+    BenchResult r;
+    r.corpus = fields.count("corpus") ? fields.at("corpus") : "";
+    r.solver = fields.count("solver") ? fields.at("solver") : "";
+    r.puzzles_per_call = static_cast<int>(number("puzzles_per_call"));
+    r.calls = static_cast<uint64_t>(number("calls"));
+    r.failures = static_cast<uint64_t>(number("failures"));
+    r.p50 = number("p50_us");
+    r.p90 = number("p90_us");
+    r.p99 = number("p99_us");
+    r.max = number("max_us");
+    r.mean = number("mean_us");
+    r.throughput = number("throughput");
+    r.nodes = number("nodes");
+    r.backtracks = number("backtracks");
+    r.max_depth = static_cast<int>(number("max_depth"));
+    r.cache_hits = static_cast<uint64_t>(number("cache_hits"));
+    r.cache_misses = static_cast<uint64_t>(number("cache_misses"));
+    return r;
+}
+
+/**
+ * @brief Reads results written by writeJson() or writeCsv().
+ */
+static bool readResults(const string& filename, vector<BenchResult>& results) {
+    ifstream file(filename);
+    if (!file.is_open()) {
+        cerr << "Unable to open file: " << filename << endl;
+        return false;
+    }
+
+    static const char* const KEYS[] = {"corpus", "solver", "puzzles_per_call", "calls", "failures", "p50_us",
+                                       "p90_us", "p99_us", "max_us", "mean_us", "throughput", "nodes",
+                                       "backtracks", "max_depth", "cache_hits", "cache_misses"};
+    string line;
+    vector<string> header;
+    while (getline(file, line)) {
+        map<string, string> fields;
+        if (line.find('{') != string::npos || line.find('"') != string::npos) {
+            // JSON: every result object sits on a line of its own
+            if (line.find("\"corpus\"") == string::npos) continue;
+            for (const char* key : KEYS) fields[key] = jsonField(line, key);
+        } else {
+            vector<string> cells;
+            stringstream stream(line);
+            string cell;
+            while (getline(stream, cell, ',')) cells.push_back(cell);
+            if (header.empty()) {
+                header = cells;
+                continue;
+            }
+            for (size_t i = 0; i < cells.size() && i < header.size(); i++) fields[header[i]] = cells[i];
+        }
+        results.push_back(resultFromFields(fields));
+    }
+
+    if (results.empty()) {
+        cerr << "No benchmark results in: " << filename << endl;
+        return false;
+    }
+    return true;
+}
+
+static double percentChange(const double& before, const double& after) {
+    return before > 0 ? (after - before) / before * 100.0 : 0.0;
+}
+
+/**
+ * @brief Prints the change of every run against the baseline.
+ *
+ * A run regresses when its throughput drops or its median latency grows by
+ * more than `threshold` percent. Node counts do not depend on the machine,
+ * so a change of more than `threshold` percent in either direction is also
+ * reported: it means the search itself behaves differently.
+ *
+ * @return true if no run regressed.
+ */
+static bool compareResults(const vector<BenchResult>& baseline, const vector<BenchResult>& results,
+                           const double& threshold) {
+    bool ok = true;
+    fprintf(stderr, "\n%-8s %-13s %12s %12s %9s %12s %12s %9s %10s %10s\n", "corpus", "solver", "base p50us",
+            "p50us", "change", "base puz/s", "puz/s", "change", "base nodes", "nodes");
+    for (const BenchResult& r : results) {
+        const auto base = find_if(baseline.begin(), baseline.end(), [&](const BenchResult& b) {
+            return b.corpus == r.corpus && b.solver == r.solver;
+        });
+        if (base == baseline.end()) {
+            fprintf(stderr, "%-8s %-13s (not in baseline)\n", r.corpus.c_str(), r.solver.c_str());
+            continue;
+        }
+        const double latency_change = percentChange(base->p50, r.p50);
+        const double throughput_change = percentChange(base->throughput, r.throughput);
+        const double node_change = percentChange(base->nodes, r.nodes);
+        const bool regressed = latency_change > threshold || throughput_change < -threshold;
+        const bool search_changed = fabs(node_change) > threshold;
+        ok = ok && !regressed && !search_changed;
+        fprintf(stderr, "%-8s %-13s %12.2f %12.2f %+8.1f%% %12.0f %12.0f %+8.1f%% %10.1f %10.1f%s%s\n",
+                r.corpus.c_str(), r.solver.c_str(), base->p50, r.p50, latency_change, base->throughput, r.throughput,
+                throughput_change, base->nodes, r.nodes, regressed ? "  REGRESSION" : "",
+                search_changed ? "  SEARCH CHANGED" : "");
+    }
+    return ok;
+}
+
+// ========================= Command line ==========================
+
+static void printUsage() {
+    cerr << "Usage: sudoku_bench [options]\n"
+            "  --corpus-dir DIR    Cache directory of the corpora (default: bench_corpora)\n"
+            "  --count N           Puzzles per corpus (default: 1000)\n"
+            "  --time SECONDS      Measuring time per backend and corpus (default: 2)\n"
+            "  --warmup SECONDS    Warm-up time per backend and corpus (default: 0.5)\n"
+            "  --corpora LIST      Comma-separated subset of easy,medium,hard,17clue\n"
+            "  --solvers LIST      Comma-separated subset of backtracking,efficient,dlx,batch (default)\n"
+            "                      or parallel\n"
+            "  --format json|csv   Output format (default: json)\n"
+            "  --output FILE       Write the results to FILE instead of stdout\n"
+            "  --compare FILE      Compare against a baseline written earlier (JSON or CSV)\n"
+            "  --threshold PERCENT Regression threshold for --compare (default: 10)\n"
+            "  --stats-puzzles N   Puzzles per corpus in the search counter pass (default: 32)\n"
+            "  --cache N           Solve through a cache of N solutions, fresh for every run; the solvers\n"
+            "                      are reported as <solver>+cache, with their cache hits and misses\n"
+            "  --regenerate        Regenerate the cached corpora\n";
+}
+
+static vector<string> splitList(const string& text) {
+    vector<string> items;
+    stringstream stream(text);
+    string item;
+    while (getline(stream, item, ',')) {
+        if (!item.empty()) items.push_back(item);
+    }
+    return items;
+}
+
+static bool parseOptions(int argc, char** argv, BenchOptions& options) {
+    for (int i = 1; i < argc; i++) {
+        const string arg = argv[i];
+        if (arg == "--regenerate") {
+            options.regenerate = true;
+            continue;
+        }
+        if (arg == "--help" || arg == "-h" || i + 1 >= argc) return false;
+
+        const string value = argv[++i];
+        if (arg == "--corpus-dir") options.corpus_dir = value;
+        else if (arg == "--count") options.corpus_size = atoi(value.c_str());
+        else if (arg == "--time") options.seconds = atof(value.c_str());
+        else if (arg == "--warmup") options.warmup = atof(value.c_str());
+        else if (arg == "--corpora") options.corpora = splitList(value);
+        else if (arg == "--solvers") options.solvers = splitList(value);
+        else if (arg == "--format") options.format = value;
+        else if (arg == "--output") options.output = value;
+        else if (arg == "--compare") options.baseline = value;
+        else if (arg == "--threshold") options.threshold = atof(value.c_str());
+        else if (arg == "--stats-puzzles") options.stats_puzzles = atoi(value.c_str());
+        else if (arg == "--cache") options.cache = atoi(value.c_str());
+        else return false;
+    }
+    return options.corpus_size > 0 && options.seconds > 0 && options.warmup >= 0 && options.stats_puzzles >= 0 &&
+           options.cache >= 0 &&
+           (options.format == "json" || options.format == "csv");
+}
+
+int main(int argc, char** argv) {
+    BenchOptions options;
+    if (!parseOptions(argc, argv, options)) {
+        printUsage();
+        return 1;
+    }
+
+    vector<Backend> backends;
+    for (const string& name : options.solvers) {
+        const vector<Backend> all = allBackends();
+        const auto it = find_if(all.begin(), all.end(), [&](const Backend& b) { return b.name == name; });
+        if (it == all.end()) {
+            cerr << "Unknown solver: " << name << endl;
+            return 1;
+        }
+        backends.push_back(*it);
+    }
+
+    vector<BenchResult> baseline;
+    if (!options.baseline.empty() && !readResults(options.baseline, baseline)) return 1;
+
+    vector<BenchResult> results;
+    for (const string& name : options.corpora) {
+        BenchCorpus corpus;
+        if (!loadCorpus(name, options, corpus)) return 1;
+
+        for (const Backend& backend : backends) {
+            BenchResult r;
+            if (options.cache > 0) {
+                SolutionCache cache(static_cast<size_t>(options.cache));
+                r = benchmark(cachedBackend(backend, cache), corpus, options);
+                r.cache_hits = cache.hits();
+                r.cache_misses = cache.misses();
+            } else {
+                r = benchmark(backend, corpus, options);
+            }
+            fprintf(stderr,
+                    "%-8s %-13s p50 %10.2fus  p90 %10.2fus  p99 %10.2fus  max %10.2fus  %12.0f puzzles/s  %10.1f nodes%s\n",
+                    r.corpus.c_str(), r.solver.c_str(), r.p50, r.p90, r.p99, r.max, r.throughput, r.nodes,
+                    r.failures ? "  WRONG SOLUTIONS" : "");
+            if (options.cache > 0) {
+                fprintf(stderr, "%-8s %-13s %llu cache hits, %llu misses\n", r.corpus.c_str(), r.solver.c_str(),
+                        static_cast<unsigned long long>(r.cache_hits), static_cast<unsigned long long>(r.cache_misses));
+            }
+            results.push_back(r);
+        }
+    }
+
+    ofstream file;
+    if (!options.output.empty()) {
+        file.open(options.output);
+        if (!file.is_open()) {
+            cerr << "Unable to open file: " << options.output << endl;
+            return 1;
+        }
+    }
+    ostream& out = options.output.empty() ? cout : file;
+    if (options.format == "csv") writeCsv(out, results);
+    else writeJson(out, results, options);
+
+    bool ok = true;
+    for (const BenchResult& r : results) ok = ok && r.failures == 0;
+    if (!baseline.empty() && !compareResults(baseline, results, options.threshold)) return 2;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,55 @@
+/**
+ * @file batch_solver.h
+ * @brief Multi-board solver that propagates many puzzles at once with SIMD.
+ *
+ * The batch solver lays out the candidate masks of `BATCH_LANES` boards in
+ * structure-of-arrays form (one 16-bit lane per board for every cell) and
+ * applies naked and hidden singles to all of them with the same instruction
+ * stream. Boards that propagation alone cannot finish are handed to the scalar
+ * solveBoardEfficient().
+ *
+ * The vector kernel uses AVX2 when the compiler targets it, SSE2 otherwise on
+ * x86-64, and plain loops on other architectures. Configure with
+ * `-DSUDOKU_NATIVE_ARCH=ON` to let the compiler use every instruction set of
+ * the build machine.
+ *
+ * @author
+ * Keshav Bhandari
+ *
+ * @date
+ * October 16, 2026
+ */
+
+#ifndef SUDOKUPROJECT_BATCH_SOLVER_H
+#define SUDOKUPROJECT_BATCH_SOLVER_H
+
+#include "board.h"
+#include "solver_stats.h"
+
+/// Number of boards propagated together by one pass of the vector kernel.
+constexpr int BATCH_LANES = 16;
+
+/**
+ * @brief Returns the name of the vector kernel compiled in ("avx2", "sse2" or "scalar").
+ */
+const char* getBatchKernelName();
+
+/**
+ * @brief Solves many independent Sudoku boards.
+ *
+ * Boards are processed in groups of `BATCH_LANES`. For each group, singles are
+ * propagated in SIMD lanes until no lane changes any more; a lane whose cells
+ * all end up with a single candidate is solved directly, a lane with a
+ * contradiction is reported as unsolvable, and every other lane is finished by
+ * solveBoardEfficient().
+ *
+ * @param boards Array of `count` boards, each solved in place.
+ * @param count Number of boards.
+ * @param solved Optional array of `count` flags receiving whether each board was solved (may be nullptr).
+ * @param stats Optional counters to add to (may be nullptr): every board counts one propagation
+ *        for the vector pass plus the counters of its scalar search, if it needed one.
+ * @return int The number of boards that were solved.
+ */
+int solveBoardsBatch(Board* boards, const int& count, bool* solved = nullptr, SolverStats* stats = nullptr);
+
+#endif //SUDOKUPROJECT_BATCH_SOLVER_H
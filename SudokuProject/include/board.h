@@ -0,0 +1,83 @@
+/**
+ * @file board.h
+ * @brief Contiguous value-type Sudoku board and adapters for the legacy `int**` API.
+ *
+ * This header defines:
+ * - The `Board` type: 81 cells stored contiguously in row-major order.
+ * - Helpers to convert between `Board` and the dynamically allocated `int**` boards.
+ *
+ * A `Board` is trivially copyable and only 81 bytes large, so it can be
+ * passed by value, copied with a plain assignment (a memcpy) and lives in two
+ * cache lines. Empty cells are denoted by 0, exactly as in the `int**` boards.
+ *
+ * @author
+ * Keshav Bhandari
+ *
+ * @date
+ * October 16, 2026
+ */
+
+#ifndef SUDOKUPROJECT_BOARD_H
+#define SUDOKUPROJECT_BOARD_H
+
+#include <array>
+#include <cstdint>
+#include <type_traits>
+
+/**
+ * @brief A 9x9 Sudoku board stored as 81 contiguous cells.
+ *
+ * Cells are addressed either by `(row, column)` through at() or by their
+ * row-major index `row * 9 + column` through operator[].
+ */
+struct Board {
+    std::array<uint8_t, 81> cells;
+
+    uint8_t& at(const int& r, const int& c) { return cells[r * 9 + c]; }
+    uint8_t at(const int& r, const int& c) const { return cells[r * 9 + c]; }
+
+    uint8_t& operator[](const int& index) { return cells[index]; }
+    uint8_t operator[](const int& index) const { return cells[index]; }
+
+    bool operator==(const Board& other) const { return cells == other.cells; }
+    bool operator!=(const Board& other) const { return cells != other.cells; }
+};
+
+static_assert(std::is_trivially_copyable<Board>::value, "Board must be copyable with memcpy");
+static_assert(sizeof(Board) == 81, "Board must hold exactly 81 byte cells");
+
+/**
+ * @brief Returns a board with all 81 cells set to 0.
+ */
+inline Board makeEmptyBoard() {
+    Board board;
+    board.cells.fill(0);
+    return board;
+}
+
+/**
+ * @brief Copies a legacy `int**` board into a `Board`.
+ *
+ * @param BOARD A pointer to the 2D Sudoku board (int**).
+ * @return Board A value copy of the board.
+ */
+Board boardFromLegacy(int** BOARD);
+
+/**
+ * @brief Writes the content of a `Board` into an existing legacy `int**` board.
+ *
+ * @param board The source board.
+ * @param BOARD A pointer to an allocated 9x9 board (int**) to overwrite.
+ */
+void copyBoardToLegacy(const Board& board, int** BOARD);
+
+/**
+ * @brief Allocates a legacy `int**` board holding the content of a `Board`.
+ *
+ * @param board The source board.
+ * @return int** A dynamically allocated 9x9 Sudoku board.
+ * @note The caller is responsible for freeing the memory with deallocateBoard().
+ */
+int** boardToLegacy(const Board& board);
+
+#endif //SUDOKUPROJECT_BOARD_H
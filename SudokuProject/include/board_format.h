@@ -0,0 +1,129 @@
+/**
+ * @file board_format.h
+ * @brief Fixed-size board formatters and a buffered multi-board writer.
+ *
+ * Both text layouts of a board have a fixed length, so a board is formatted
+ * straight into a caller-provided buffer without building strings:
+ * - the pretty layout written by writeSudokuToFile() (`-` for blanks, `|`
+ *   between boxes and a line of dots between bands), PRETTY_BOARD_SIZE characters;
+ * - the one-line layout (`.` for blanks), LINE_BOARD_SIZE characters.
+ *
+ * BoardWriter collects many formatted boards in one buffer and hands them to
+ * the output stream in large writes instead of one write per board.
+ *
+ * @author
+ * Keshav Bhandari
+ *
+ * @date
+ * October 16, 2026
+ */
+
+#ifndef SUDOKUPROJECT_BOARD_FORMAT_H
+#define SUDOKUPROJECT_BOARD_FORMAT_H
+
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "board.h"
+
+/// Length of the pretty layout: 9 rows of 23 characters plus 2 separator lines of 22.
+constexpr int PRETTY_BOARD_SIZE = 9 * 23 + 2 * 22;
+
+/// Length of the one-line layout, without the line break.
+constexpr int LINE_BOARD_SIZE = 81;
+
+/**
+ * @brief Text layouts supported by BoardWriter.
+ */
+enum class BoardFormat {
+    Pretty,   ///< The layout of formatBoard(); boards are separated by an empty line
+    Line      ///< The layout of formatBoardLine(); one board per line
+};
+
+/**
+ * @brief Formats a board in the pretty layout.
+ *
+ * @param board The board to format.
+ * @param out Destination of at least PRETTY_BOARD_SIZE characters (no terminating NUL is written).
+ * @return int The number of characters written (always PRETTY_BOARD_SIZE).
+ */
+int formatBoard(const Board& board, char* out);
+
+/**
+ * @brief Formats a board as a single line of 81 characters.
+ *
+ * @param board The board to format.
+ * @param out Destination of at least LINE_BOARD_SIZE characters (no line break or NUL is written).
+ * @return int The number of characters written (always LINE_BOARD_SIZE).
+ */
+int formatBoardLine(const Board& board, char* out);
+
+/**
+ * @brief Buffers formatted boards and writes them to a stream in large chunks.
+ *
+ * The stream stays owned by the caller; the writer only flushes into it.
+ */
+class BoardWriter {
+public:
+    /**
+     * @brief Creates a writer for an open stream.
+     *
+     * @param out The output stream (e.g. stdout or a file opened with fopen).
+     * @param format Layout of the boards (default: BoardFormat::Pretty).
+     * @param buffer_size Number of buffered bytes that triggers a write (default: 1 MiB).
+     */
+    explicit BoardWriter(std::FILE* out, const BoardFormat& format = BoardFormat::Pretty,
+                         const size_t& buffer_size = 1 << 20);
+
+    /**
+     * @brief Writes out whatever is still buffered.
+     */
+    ~BoardWriter();
+
+    BoardWriter(const BoardWriter&) = delete;
+    BoardWriter& operator=(const BoardWriter&) = delete;
+
+    /**
+     * @brief Appends one board in the writer's format.
+     */
+    void add(const Board& board);
+
+    /**
+     * @brief Appends a line of raw text (a line break is added).
+     */
+    void addLine(const char* text, const size_t& length);
+
+    /**
+     * @brief Writes the buffer to the stream.
+     *
+     * @return true if every byte was written, false on an I/O error.
+     */
+    bool flush();
+
+    /**
+     * @brief Returns the number of boards added so far.
+     */
+    size_t size() const { return count; }
+
+private:
+    std::FILE* out;
+    BoardFormat format;
+    size_t threshold;
+    std::vector<char> buffer;
+    size_t count = 0;
+    bool failed = false;
+};
+
+/**
+ * @brief Writes many boards into a single file through a BoardWriter.
+ *
+ * @param boards The boards, in file order.
+ * @param filename Path of the file to create.
+ * @param format Layout of the boards (default: BoardFormat::Pretty).
+ * @return true if the file was written, false otherwise.
+ */
+bool writeBoardsToFile(const std::vector<Board>& boards, const std::string& filename,
+                       const BoardFormat& format = BoardFormat::Pretty);
+
+#endif //SUDOKUPROJECT_BOARD_FORMAT_H
@@ -0,0 +1,77 @@
+/**
+ * @file canonical.h
+ * @brief Sudoku symmetries and the minimal lexicographic canonical form.
+ *
+ * Two puzzles are isomorphic when one becomes the other through validity-
+ * preserving transformations:
+ * - relabeling the digits,
+ * - permuting the rows inside a band, or the columns inside a stack,
+ * - permuting the bands, or the stacks,
+ * - transposing the grid.
+ * The canonical form of a puzzle is the smallest of all its isomorphs when
+ * the 81 cells are read in row-major order (blanks sort first), so two
+ * puzzles are isomorphic exactly when their canonical forms are equal.
+ *
+ * @author
+ * Keshav Bhandari
+ *
+ * @date
+ * October 16, 2026
+ */
+
+#ifndef SUDOKUPROJECT_CANONICAL_H
+#define SUDOKUPROJECT_CANONICAL_H
+
+#include <cstdint>
+#include "board.h"
+#include "rng.h"
+
+/**
+ * @brief One symmetry of the grid.
+ *
+ * Cell `(r, c)` of the transformed board is read from cell `(rows[r], cols[c])`
+ * of the source board (of its transpose when `transpose` is set), and its
+ * digit `k` is written as `digits[k]`.
+ */
+struct BoardTransform {
+    bool transpose = false;
+    uint8_t rows[9] = {0, 1, 2, 3, 4, 5, 6, 7, 8};
+    uint8_t cols[9] = {0, 1, 2, 3, 4, 5, 6, 7, 8};
+    uint8_t digits[10] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};   ///< A permutation of 1-9; digits[0] stays 0
+};
+
+/**
+ * @brief Applies a transform to a board.
+ */
+Board applyTransform(const Board& board, const BoardTransform& transform);
+
+/**
+ * @brief Undoes a transform: `invertTransform(applyTransform(b, t), t) == b`.
+ */
+Board invertTransform(const Board& board, const BoardTransform& transform);
+
+/**
+ * @brief Draws a uniformly random symmetry of the grid.
+ *
+ * @param rng The random generator to draw from.
+ */
+BoardTransform randomTransform(Rng& rng);
+
+/**
+ * @brief Computes the canonical form of a board.
+ *
+ * A branch-and-bound search over the transforms: the first row and its
+ * column order are chosen cell by cell, then the other rows one at a time,
+ * always keeping only the choices that give the smallest next cell or row
+ * and cutting every branch that falls behind the best form found so far.
+ * Typical puzzles take a few hundred microseconds; nearly empty boards have
+ * so many equivalent transforms that the search becomes very slow.
+ *
+ * @param board The board to canonicalize.
+ * @param transform Optional output receiving a transform with
+ *        `applyTransform(board, *transform)` equal to the result (may be nullptr).
+ * @return Board The canonical form.
+ */
+Board canonicalForm(const Board& board, BoardTransform* transform = nullptr);
+
+#endif //SUDOKUPROJECT_CANONICAL_H
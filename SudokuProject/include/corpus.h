@@ -0,0 +1,225 @@
+/**
+ * @file corpus.h
+ * @brief Packed single-file binary corpus of Sudoku puzzles.
+ *
+ * A corpus file stores any number of puzzles as fixed-size records behind a
+ * 32-byte header, so record i lives at a known offset and can be read without
+ * parsing anything before it. All integers are little-endian.
+ *
+ * Header:
+ * | Offset | Size | Field                                            |
+ * |--------|------|--------------------------------------------------|
+ * | 0      | 4    | Magic "SDKC"                                     |
+ * | 4      | 2    | Format version (1)                               |
+ * | 6      | 2    | Flags: 1 = records hold a solution, 2 = metadata |
+ * | 8      | 4    | Record size in bytes                             |
+ * | 12     | 4    | Reserved (0)                                     |
+ * | 16     | 8    | Number of records                                |
+ * | 24     | 8    | Reserved (0)                                     |
+ *
+ * Record: the puzzle packed into 41 bytes (two cells per byte, cell `2i` in
+ * the low nibble of byte `i`), then the packed solution (41 bytes) if the
+ * solution flag is set, then a CorpusMetadata (8 bytes) if the metadata flag
+ * is set.
+ *
+ * CorpusReader maps the whole file into memory (on Windows it reads it in one
+ * call instead), so opening a corpus costs a few syscalls whatever its size
+ * and every record is accessed in place.
+ *
+ * @author
+ * Keshav Bhandari
+ *
+ * @date
+ * October 16, 2026
+ */
+
+#ifndef SUDOKUPROJECT_CORPUS_H
+#define SUDOKUPROJECT_CORPUS_H
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "board.h"
+
+/// Size of a nibble-packed board.
+constexpr int PACKED_BOARD_SIZE = 41;
+
+/// Size of the corpus file header.
+constexpr int CORPUS_HEADER_SIZE = 32;
+
+/// Header flag: every record stores a solution after the puzzle.
+constexpr uint16_t CORPUS_HAS_SOLUTIONS = 1;
+
+/// Header flag: every record ends with a CorpusMetadata.
+constexpr uint16_t CORPUS_HAS_METADATA = 2;
+
+/**
+ * @brief Optional per-puzzle information stored in a corpus record (8 bytes on disk).
+ */
+struct CorpusMetadata {
+    uint32_t id = 0;          ///< Caller-defined identifier (e.g. generation index)
+    uint16_t score = 0;       ///< Difficulty score (see rater.h)
+    uint8_t difficulty = 0;   ///< Difficulty band (see rater.h)
+    uint8_t technique = 0;    ///< Hardest technique (see rater.h)
+};
+
+/**
+ * @brief Packs a board into 41 bytes, two cells per byte.
+ *
+ * @param board The board to pack (cells must be 0-9).
+ * @param out Destination of at least PACKED_BOARD_SIZE bytes.
+ */
+void packBoard(const Board& board, uint8_t* out);
+
+/**
+ * @brief Unpacks a board written by packBoard().
+ *
+ * @param in Source of PACKED_BOARD_SIZE bytes.
+ * @param board The board that receives the cells.
+ */
+void unpackBoard(const uint8_t* in, Board& board);
+
+/**
+ * @brief Writes a corpus file record by record through a large buffer.
+ */
+class CorpusWriter {
+public:
+    CorpusWriter() = default;
+
+    /**
+     * @brief Closes the file if it is still open.
+     */
+    ~CorpusWriter();
+
+    CorpusWriter(const CorpusWriter&) = delete;
+    CorpusWriter& operator=(const CorpusWriter&) = delete;
+
+    /**
+     * @brief Creates (or truncates) a corpus file.
+     *
+     * @param filename Path of the corpus file.
+     * @param flags Combination of CORPUS_HAS_SOLUTIONS and CORPUS_HAS_METADATA (default: 0).
+     * @return true if the file was created, false otherwise.
+     */
+    bool open(const std::string& filename, const uint16_t& flags = 0);
+
+    /**
+     * @brief Appends one record.
+     *
+     * Fields that the file was not opened for are ignored; fields it was opened
+     * for but that are passed as nullptr are written as zeros.
+     *
+     * @param puzzle The puzzle.
+     * @param solution Its solution (may be nullptr).
+     * @param metadata Its metadata (may be nullptr).
+     * @return true if the record was buffered, false if the writer is not open.
+     */
+    bool add(const Board& puzzle, const Board* solution = nullptr, const CorpusMetadata* metadata = nullptr);
+
+    /**
+     * @brief Flushes the remaining records, writes the final record count and closes the file.
+     *
+     * @return true if everything was written, false on an I/O error.
+     */
+    bool close();
+
+    /**
+     * @brief Returns the number of records added so far.
+     */
+    uint64_t size() const { return count; }
+
+private:
+    std::ofstream file;
+    std::vector<uint8_t> buffer;
+    uint16_t flags = 0;
+    uint32_t recordSize = 0;
+    uint64_t count = 0;
+
+    bool flushBuffer();
+};
+
+/**
+ * @brief Read-only, zero-copy view of a corpus file.
+ */
+class CorpusReader {
+public:
+    CorpusReader() = default;
+
+    /**
+     * @brief Releases the mapping.
+     */
+    ~CorpusReader();
+
+    CorpusReader(const CorpusReader&) = delete;
+    CorpusReader& operator=(const CorpusReader&) = delete;
+
+    /**
+     * @brief Maps a corpus file and validates its header.
+     *
+     * Fails if the file cannot be opened, is not a corpus of a supported
+     * version, or is shorter than its header claims.
+     *
+     * @param filename Path of the corpus file.
+     * @return true if the corpus is ready to read, false otherwise.
+     */
+    bool open(const std::string& filename);
+
+    /**
+     * @brief Releases the mapping; the reader can be opened again afterwards.
+     */
+    void close();
+
+    /**
+     * @brief Returns the number of records.
+     */
+    uint64_t size() const { return count; }
+
+    bool hasSolutions() const { return (flags & CORPUS_HAS_SOLUTIONS) != 0; }
+    bool hasMetadata() const { return (flags & CORPUS_HAS_METADATA) != 0; }
+
+    /**
+     * @brief Returns a pointer to the raw bytes of record `index` inside the mapping.
+     */
+    const uint8_t* record(const uint64_t& index) const { return records + index * recordSize; }
+
+    /**
+     * @brief Unpacks the puzzle of record `index`.
+     */
+    void puzzle(const uint64_t& index, Board& board) const;
+
+    /**
+     * @brief Unpacks the solution of record `index`.
+     *
+     * @return true if the corpus stores solutions, false otherwise (the board is left unchanged).
+     */
+    bool solution(const uint64_t& index, Board& board) const;
+
+    /**
+     * @brief Reads the metadata of record `index`.
+     *
+     * @return true if the corpus stores metadata, false otherwise.
+     */
+    bool metadata(const uint64_t& index, CorpusMetadata& metadata) const;
+
+private:
+    const uint8_t* data = nullptr;   // Whole file
+    const uint8_t* records = nullptr;
+    size_t length = 0;
+    uint16_t flags = 0;
+    uint32_t recordSize = 0;
+    uint64_t count = 0;
+    std::vector<uint8_t> fallback;   // File contents where mmap is unavailable
+};
+
+/**
+ * @brief Writes a whole set of puzzles as a corpus file.
+ *
+ * @param filename Path of the corpus file.
+ * @param puzzles The puzzles, in record order.
+ * @param solutions Optional solutions, one per puzzle (may be nullptr).
+ * @return true if the file was written, false otherwise.
+ */
+bool writeCorpus(const std::string& filename, const std::vector<Board>& puzzles, const std::vector<Board>* solutions = nullptr);
+
+#endif //SUDOKUPROJECT_CORPUS_H
@@ -0,0 +1,51 @@
+/**
+ * @file dlx.h
+ * @brief Exact-cover Sudoku solver based on Knuth's Dancing Links (Algorithm X).
+ *
+ * Sudoku is modelled as an exact-cover problem with 729 rows (one per
+ * cell/digit choice) and 324 columns:
+ * - 81 cell constraints (every cell holds exactly one digit),
+ * - 81 row-digit, 81 column-digit and 81 box-digit constraints
+ *   (every digit appears exactly once in each unit).
+ *
+ * The full link structure is built once per thread in a preallocated node
+ * pool. A solve covers the givens, searches with the smallest-column
+ * heuristic and uncovers everything again, so no memory is allocated per solve.
+ *
+ * @author
+ * Keshav Bhandari
+ *
+ * @date
+ * October 16, 2026
+ */
+
+#ifndef SUDOKUPROJECT_DLX_H
+#define SUDOKUPROJECT_DLX_H
+
+#include "board.h"
+#include "solver_stats.h"
+
+/**
+ * @brief Solves a Sudoku board with Dancing Links.
+ *
+ * Rejects boards whose givens repeat a digit in a unit, then runs Algorithm X
+ * choosing the column with the fewest remaining rows at every step.
+ *
+ * @param board The Sudoku board, solved in place.
+ * @return true if the board is solvable, false otherwise (the board is left unchanged).
+ */
+bool solveBoardDancingLinks(Board& board);
+
+/**
+ * @brief Instrumented solveBoardDancingLinks(): also adds the search counters of the solve to `stats`.
+ *
+ * Nodes are the columns branched on, candidate checks the rows tried in
+ * them, and the selection time covers the smallest-column scan.
+ *
+ * @param board The Sudoku board, solved in place.
+ * @param stats The counters to add to (see solver_stats.h).
+ * @return true if the board is solvable, false otherwise (the board is left unchanged).
+ */
+bool solveBoardDancingLinks(Board& board, SolverStats& stats);
+
+#endif //SUDOKUPROJECT_DLX_H
@@ -9,6 +9,12 @@
  * - Randomly delete cells to create a solvable puzzle.
  * - Generate a complete Sudoku puzzle with a specific number of empty cells.
  *
+ * Every random step has an overload taking the generator (see rng.h)
+ * explicitly, so a caller that seeds it gets reproducible puzzles. The
+ * overloads without a generator draw from threadRng(), the per-thread stream
+ * of the global seed. Puzzles can also be generated with a guaranteed unique
+ * solution or for a difficulty band rated by rater.h.
+ *
  * Detailed function descriptions and parameters are provided below.
  *
  * @author
@@ -22,6 +28,9 @@
 #define GENERATOR_H
 
 #include <vector>
+#include "rng.h"
+#include "board.h"
+#include "rater.h"
 
 /**
  * @brief Creates and returns a new empty 9x9 Sudoku board.
@@ -45,6 +54,14 @@ int** getEmptyBoard();
  */
 std::vector<int> getShuffledVector();
 
+/**
+ * @brief Generates a vector of numbers 1-9 shuffled with the given generator.
+ *
+ * @param rng The random generator to draw from.
+ * @return std::vector<int> A vector containing numbers 1-9 in random order.
+ */
+std::vector<int> getShuffledVector(Rng& rng);
+
 /**
  * @brief Fills the three diagonal 3x3 boxes of a Sudoku board with random numbers.
  *
@@ -52,9 +69,24 @@ std::vector<int> getShuffledVector();
  * with unique numbers from 1 to 9 in random order. The diagonal boxes are independent
  * of each other, meaning they can be filled without checking for conflicts.
  *
- * @param BOARD A 9x9 Sudoku board to be filled.
+ * @param board A 9x9 Sudoku board to be filled.
  * @note The board should be empty (all cells set to 0) before calling this function.
  */
+void fillBoardWithIndependentBox(Board& board);
+
+/**
+ * @brief Fills the three diagonal 3x3 boxes using the given random generator.
+ *
+ * @param board A 9x9 Sudoku board to be filled.
+ * @param rng The random generator to draw from.
+ */
+void fillBoardWithIndependentBox(Board& board, Rng& rng);
+
+/**
+ * @brief Legacy adapter of fillBoardWithIndependentBox() for `int**` boards.
+ *
+ * @param BOARD A 9x9 Sudoku board to be filled.
+ */
 void fillBoardWithIndependentBox(int** BOARD);
 
 /**
@@ -65,6 +97,25 @@ void fillBoardWithIndependentBox(int** BOARD);
  * only once. The function ensures that the specified number of cells is valid
  * (between 1 and 81) and that the board pointer is not null.
  *
+ * @param board A 9x9 Sudoku board from which cells will be deleted.
+ * @param n The number of cells to delete (must be between 1 and 81).
+ * @throw std::invalid_argument If n is not between 1 and 81.
+ */
+void deleteRandomItems(Board& board, const int& n);
+
+/**
+ * @brief Randomly deletes `n` cells using the given random generator.
+ *
+ * @param board A 9x9 Sudoku board from which cells will be deleted.
+ * @param n The number of cells to delete (must be between 1 and 81).
+ * @param rng The random generator to draw from.
+ * @throw std::invalid_argument If n is not between 1 and 81.
+ */
+void deleteRandomItems(Board& board, const int& n, Rng& rng);
+
+/**
+ * @brief Legacy adapter of deleteRandomItems() for `int**` boards.
+ *
  * @param BOARD A 9x9 Sudoku board from which cells will be deleted.
  * @param n The number of cells to delete (must be between 1 and 81).
  * @throw std::invalid_argument If BOARD is null or n is not between 1 and 81.
@@ -83,10 +134,82 @@ void deleteRandomItems(int** BOARD, const int& n);
  * The resulting board is guaranteed to be solvable and contains the specified
  * number of empty cells.
  *
+ * @param board The board that receives the generated puzzle.
+ * @param empty_boxes The number of cells to be emptied in the generated puzzle (0-81; 0 gives a full grid).
+ */
+void generateBoard(Board& board, const int& empty_boxes);
+
+/**
+ * @brief Generates a puzzle using the given random generator.
+ *
+ * The same generator state always produces the same puzzle.
+ *
+ * @param board The board that receives the generated puzzle.
+ * @param empty_boxes The number of cells to be emptied in the generated puzzle (0-81; 0 gives a full grid).
+ * @param rng The random generator to draw from.
+ */
+void generateBoard(Board& board, const int& empty_boxes, Rng& rng);
+
+/**
+ * @brief Legacy adapter of generateBoard() returning an `int**` board.
+ *
  * @param empty_boxes The number of cells to be emptied in the generated puzzle.
  * @return int** A dynamically allocated 9x9 Sudoku board with the specified number of empty cells.
  * @note The caller is responsible for freeing the allocated memory.
  */
 int** generateBoard(const int& empty_boxes);
 
+/**
+ * @brief Generates a puzzle that is guaranteed to have a unique solution.
+ *
+ * Builds a complete board as generateBoard() does, then visits the cells in
+ * random order and clears each one only if the puzzle stays unique. Since the
+ * puzzle is unique before every removal, the check reduces to
+ * hasSolutionExcluding() with the removed digit, a single search that reuses
+ * the known solution instead of counting solutions.
+ *
+ * Not every target is reachable: unique puzzles rarely have more than about
+ * 55-60 empty cells, so the function stops early when no cell can be removed.
+ *
+ * @param board The board that receives the generated puzzle.
+ * @param empty_boxes The requested number of empty cells.
+ * @param rng The random generator to draw from.
+ * @return int The number of cells actually emptied (at most `empty_boxes`).
+ */
+int generateUniqueBoard(Board& board, const int& empty_boxes, Rng& rng);
+
+/**
+ * @brief Generates a unique-solution puzzle using the thread's generator (see threadRng()).
+ *
+ * @param board The board that receives the generated puzzle.
+ * @param empty_boxes The requested number of empty cells.
+ * @return int The number of cells actually emptied (at most `empty_boxes`).
+ */
+int generateUniqueBoard(Board& board, const int& empty_boxes);
+
+/**
+ * @brief Generates a unique-solution puzzle of the requested difficulty band.
+ *
+ * Keeps generating unique puzzles (see generateUniqueBoard()) and rating them
+ * with ratePuzzle() until one falls into the `target` band. The number of empty
+ * cells requested per attempt grows with the band, since harder techniques
+ * are only needed on sparser puzzles.
+ *
+ * @param board The board that receives the generated puzzle.
+ * @param target The difficulty band to hit.
+ * @param rng The random generator to draw from.
+ * @param max_attempts Number of puzzles to try before giving up (default: 10000).
+ * @param rating Optional output receiving the rating of the puzzle left in `board`,
+ *               whether or not it is in the band (may be nullptr).
+ * @return true if a puzzle of the band was found, false if every attempt missed
+ *         (the board then holds the last attempt and `rating` its rating).
+ */
+bool generateBoardWithDifficulty(Board& board, const Difficulty& target, Rng& rng,
+                                 const int& max_attempts = 10000, DifficultyRating* rating = nullptr);
+
+/**
+ * @brief Generates a puzzle of the requested difficulty band using the thread's generator (see threadRng()).
+ */
+bool generateBoardWithDifficulty(Board& board, const Difficulty& target);
+
 #endif // GENERATOR_H
@@ -0,0 +1,181 @@
+/**
+ * @file grid.h
+ * @brief Boards of any box size: 4x4, 9x9, 16x16 and 25x25 grids.
+ *
+ * A grid with boxes of `BOX` x `BOX` cells has `N = BOX * BOX` rows, columns,
+ * boxes and digits, and `N * N` cells. Everything that depends on the size is
+ * a compile-time constant of GridTraits, so the generic solver (grid_solver.h)
+ * gets fixed loop bounds and the narrowest candidate mask for each size.
+ *
+ * `Grid<3>` is the classic `Board`: the 9x9 instantiation of the generic API
+ * is specialized to the existing bitmask solvers and generator, so classic
+ * puzzles keep their performance. The other sizes use `GridBoard<BOX>`.
+ *
+ * Digits are written `1`-`9`, then `A`-`P` for 10-25 (so a 16x16 grid uses
+ * `1`-`9` and `A`-`G`); blanks are written `.`.
+ *
+ * @author
+ * Keshav Bhandari
+ *
+ * @date
+ * October 16, 2026
+ */
+
+#ifndef SUDOKUPROJECT_GRID_H
+#define SUDOKUPROJECT_GRID_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <type_traits>
+#include "board.h"
+
+/**
+ * @brief Size constants of a grid with `BOX` x `BOX` boxes.
+ */
+template <int BOX>
+struct GridTraits {
+    static_assert(BOX >= 2 && BOX <= 5, "Supported grids are 4x4, 9x9, 16x16 and 25x25");
+
+    static constexpr int BOX_SIZE = BOX;        ///< Rows and columns of a box
+    static constexpr int SIZE = BOX * BOX;      ///< Rows, columns, boxes and digits
+    static constexpr int CELLS = SIZE * SIZE;   ///< Cells of the grid
+    static constexpr int PEERS = 2 * (SIZE - 1) + (BOX - 1) * (BOX - 1);  ///< Cells sharing a unit with a cell
+
+    /// Candidate mask: digit `k` is bit `k - 1`
+    using Mask = typename std::conditional<(SIZE <= 16), uint16_t, uint32_t>::type;
+
+    /// Mask with one bit set for each digit
+    static constexpr Mask ALL = static_cast<Mask>((uint64_t(1) << SIZE) - 1);
+};
+
+/**
+ * @brief Contiguous row-major board of a generic grid; empty cells are 0.
+ */
+template <int BOX>
+struct GridBoard {
+    static constexpr int SIZE = GridTraits<BOX>::SIZE;
+
+    std::array<uint8_t, GridTraits<BOX>::CELLS> cells;
+
+    uint8_t& at(const int& r, const int& c) { return cells[r * SIZE + c]; }
+    uint8_t at(const int& r, const int& c) const { return cells[r * SIZE + c]; }
+
+    uint8_t& operator[](const int& index) { return cells[index]; }
+    uint8_t operator[](const int& index) const { return cells[index]; }
+
+    bool operator==(const GridBoard& other) const { return cells == other.cells; }
+    bool operator!=(const GridBoard& other) const { return cells != other.cells; }
+};
+
+template <int BOX>
+struct GridSelector {
+    using type = GridBoard<BOX>;
+};
+
+template <>
+struct GridSelector<3> {
+    using type = Board;
+};
+
+/**
+ * @brief The board type of a grid with `BOX` x `BOX` boxes (`Board` for 9x9).
+ */
+template <int BOX>
+using Grid = typename GridSelector<BOX>::type;
+
+/**
+ * @brief Returns a grid with all cells set to 0.
+ */
+template <int BOX>
+Grid<BOX> makeEmptyGrid() {
+    Grid<BOX> grid;
+    grid.cells.fill(0);
+    return grid;
+}
+
+/**
+ * @brief Returns the character of a cell value (`.` for 0, `1`-`9`, then `A`-`P`).
+ */
+inline char gridSymbol(const int& value) {
+    if (value == 0) return '.';
+    return static_cast<char>(value <= 9 ? '0' + value : 'A' + value - 10);
+}
+
+/**
+ * @brief Returns the value of a cell character: 0 for a blank, -1 for an invalid character.
+ *
+ * Letters are accepted in both cases; `0`, `.` and `-` are blanks.
+ */
+inline int gridValue(const char& symbol) {
+    if (symbol == '0' || symbol == '.' || symbol == '-') return 0;
+    if (symbol >= '1' && symbol <= '9') return symbol - '0';
+    if (symbol >= 'A' && symbol <= 'P') return symbol - 'A' + 10;
+    if (symbol >= 'a' && symbol <= 'p') return symbol - 'a' + 10;
+    return -1;
+}
+
+/**
+ * @brief Formats a grid as a single line of `N * N` characters.
+ *
+ * For 9x9 grids the output is the same as formatBoardLine().
+ *
+ * @param grid The grid to format.
+ * @param out Destination of at least `GridTraits<BOX>::CELLS` characters (no line break or NUL is written).
+ * @return int The number of characters written.
+ */
+template <int BOX>
+int formatGridLine(const Grid<BOX>& grid, char* out) {
+    for (int i = 0; i < GridTraits<BOX>::CELLS; i++) out[i] = gridSymbol(grid[i]);
+    return GridTraits<BOX>::CELLS;
+}
+
+/**
+ * @brief Parses a grid from one line of `N * N` cell characters.
+ *
+ * Spaces, tabs and line breaks are skipped; any other character must be a
+ * cell (see gridValue()) whose digit fits the grid. Givens are not checked
+ * for repeated digits: the solvers report such grids as unsolvable.
+ *
+ * @param text The text to parse.
+ * @param length Number of characters in `text`.
+ * @param grid The grid that receives the puzzle (unspecified on error).
+ * @return true if the text holds exactly `N * N` valid cells, false otherwise.
+ */
+template <int BOX>
+bool parseGridLine(const char* text, const size_t& length, Grid<BOX>& grid) {
+    int cells = 0;
+    for (size_t i = 0; i < length; i++) {
+        const char symbol = text[i];
+        if (symbol == ' ' || symbol == '\t' || symbol == '\r' || symbol == '\n') continue;
+        const int value = gridValue(symbol);
+        if (value < 0 || value > GridTraits<BOX>::SIZE || cells == GridTraits<BOX>::CELLS) return false;
+        grid[cells++] = static_cast<uint8_t>(value);
+    }
+    return cells == GridTraits<BOX>::CELLS;
+}
+
+/**
+ * @brief Prints a grid with `|` and `-` separators between the boxes, like printBoard().
+ *
+ * @param grid The grid to print.
+ * @param out The stream to print to.
+ */
+template <int BOX>
+void printGrid(const Grid<BOX>& grid, std::ostream& out) {
+    constexpr int N = GridTraits<BOX>::SIZE;
+    for (int r = 0; r < N; r++) {
+        if (r > 0 && r % BOX == 0) {
+            for (int c = 0; c < 2 * N + 2 * (BOX - 1) - 1; c++) out << '-';
+            out << '\n';
+        }
+        for (int c = 0; c < N; c++) {
+            if (c > 0 && c % BOX == 0) out << "| ";
+            out << gridSymbol(grid.at(r, c)) << (c + 1 < N ? " " : "");
+        }
+        out << '\n';
+    }
+}
+
+#endif //SUDOKUPROJECT_GRID_H
@@ -0,0 +1,498 @@
+/**
+ * @file grid_solver.h
+ * @brief Solver and generator for grids of any box size (see grid.h).
+ *
+ * The generic search keeps one candidate mask per cell and branches on the
+ * cell with the fewest candidates (MRV) after propagating naked and hidden
+ * singles to a fixpoint. The mask type, the loop bounds and the peer and
+ * unit tables are fixed by the box size, so each size is compiled with
+ * constant trip counts the compiler can unroll. Plain backtracking is
+ * hopeless on 16x16 and 25x25 grids; with propagation most of them are
+ * solved with few or no branches.
+ *
+ * The 9x9 instantiations (`BOX = 3`) are specialized to the existing engine:
+ * solveBoardEfficient(), countSolutions(), generateBoard() and
+ * generateUniqueBoard().
+ *
+ * @author
+ * Keshav Bhandari
+ *
+ * @date
+ * October 16, 2026
+ */
+
+#ifndef SUDOKUPROJECT_GRID_SOLVER_H
+#define SUDOKUPROJECT_GRID_SOLVER_H
+
+#include <cstdint>
+#include <vector>
+#include "grid.h"
+#include "rng.h"
+
+/**
+ * @brief Search over the cells of a `BOX` x `BOX`-box grid.
+ *
+ * A solver owns its scratch states, so one instance must not be shared
+ * between threads; the free functions below create one per call.
+ */
+template <int BOX>
+class GridSolver {
+public:
+    using Traits = GridTraits<BOX>;
+    using Mask = typename Traits::Mask;
+    using GridType = Grid<BOX>;
+
+    static constexpr int N = Traits::SIZE;
+    static constexpr int CELLS = Traits::CELLS;
+    static constexpr int UNITS = 3 * N;
+
+    /**
+     * @brief Counts the solutions of a grid, stopping at `limit`.
+     *
+     * @param grid The puzzle.
+     * @param limit Stop after this many solutions (0 = count all).
+     * @param solution Optional output receiving the first solution found (may be nullptr).
+     * @param rng Optional generator; when set, the digits of every branch are tried in random order.
+     * @param node_budget Give up after this many branches (0 = no budget); the result is then 0.
+     * @return uint64_t The number of solutions found, at most `limit`.
+     */
+    uint64_t search(const GridType& grid, const uint64_t& limit, GridType* solution = nullptr, Rng* rng = nullptr,
+                    const uint64_t& node_budget = 0) {
+        levels.resize(1);
+        if (!load(grid, levels[0])) return 0;
+        return run(limit, solution, rng, node_budget);
+    }
+
+    /**
+     * @brief Returns true if the grid has a solution in which cell `cell` is not `k`.
+     *
+     * @param node_budget Give up after this many branches (0 = no budget); an
+     *        exhausted budget counts as "has such a solution", the safe answer
+     *        when deciding whether a given can be removed.
+     */
+    bool hasSolutionExcluding(const GridType& grid, const int& cell, const int& k, const uint64_t& node_budget = 0) {
+        levels.resize(1);
+        State& state = levels[0];
+        if (!load(grid, state)) return false;
+        if (state.cells[cell] != 0) {
+            return state.cells[cell] != k && (run(1, nullptr, nullptr, node_budget) > 0 || exhausted);
+        }
+        state.candidates[cell] &= static_cast<Mask>(~bit(k));
+        if (!state.candidates[cell]) return false;
+        if (isSingle(state.candidates[cell])) pending[pendingCount++] = static_cast<uint16_t>(cell);
+        if (!propagate(state)) return false;
+        return run(1, nullptr, nullptr, node_budget) > 0 || exhausted;
+    }
+
+private:
+    struct State {
+        std::array<uint8_t, CELLS> cells;
+        std::array<Mask, CELLS> candidates;   // 0 for filled cells
+        int empty;
+    };
+
+    // The cells a box shares with a line, and the rest of that line and of that box
+    struct Intersection {
+        uint16_t segment[BOX];
+        uint16_t lineRest[N - BOX];
+        uint16_t boxRest[N - BOX];
+        uint16_t lineSections[BOX - 1];   // the other intersections of the line
+        uint16_t boxSections[BOX - 1];    // the other intersections of the box with parallel lines
+    };
+
+    struct Tables {
+        uint16_t peers[CELLS][Traits::PEERS];
+        uint16_t units[UNITS][N];
+        Intersection intersections[2 * N * BOX];
+
+        Tables() {
+            for (int i = 0; i < N; i++) {
+                for (int j = 0; j < N; j++) {
+                    units[i][j] = static_cast<uint16_t>(i * N + j);                // row i
+                    units[N + i][j] = static_cast<uint16_t>(j * N + i);            // column i
+                    units[2 * N + i][j] = static_cast<uint16_t>(                   // box i
+                        ((i / BOX) * BOX + j / BOX) * N + (i % BOX) * BOX + j % BOX);
+                }
+            }
+            for (int cell = 0; cell < CELLS; cell++) {
+                const int r = cell / N, c = cell % N;
+                int count = 0;
+                for (int other = 0; other < CELLS; other++) {
+                    const int r2 = other / N, c2 = other % N;
+                    const bool peer = r2 == r || c2 == c || (r2 / BOX == r / BOX && c2 / BOX == c / BOX);
+                    if (peer && other != cell) peers[cell][count++] = static_cast<uint16_t>(other);
+                }
+            }
+            // Every box crossed with each of its BOX rows, then with each of its BOX columns:
+            // intersection (b * 2 + column) * BOX + l
+            int index = 0;
+            for (int b = 0; b < N; b++) {
+                const uint16_t* box = units[2 * N + b];
+                for (int column = 0; column < 2; column++) {
+                    for (int l = 0; l < BOX; l++) {
+                        const int line = column ? (b % BOX) * BOX + l : (b / BOX) * BOX + l;
+                        const uint16_t* cells = units[column ? N + line : line];
+                        Intersection& section = intersections[index++];
+                        int inSegment = 0, inLine = 0, inBox = 0;
+                        for (int j = 0; j < N; j++) {
+                            const int r = cells[j] / N, c = cells[j] % N;
+                            if ((r / BOX) * BOX + c / BOX == b) section.segment[inSegment++] = cells[j];
+                            else section.lineRest[inLine++] = cells[j];
+                        }
+                        for (int j = 0; j < N; j++) {
+                            const int r = box[j] / N, c = box[j] % N;
+                            if ((column ? c : r) != line) section.boxRest[inBox++] = box[j];
+                        }
+                        int inLineSections = 0, inBoxSections = 0;
+                        for (int k = 0; k < BOX; k++) {
+                            const int other = column ? k * BOX + b % BOX : (b / BOX) * BOX + k;
+                            if (other != b) {
+                                section.lineSections[inLineSections++] = static_cast<uint16_t>((other * 2 + column) * BOX + l);
+                            }
+                            if (k != l) {
+                                section.boxSections[inBoxSections++] = static_cast<uint16_t>((b * 2 + column) * BOX + k);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    };
+
+    std::vector<State> levels;        // levels[d] is the state at search depth d
+    uint16_t pending[CELLS];          // cells left with a single candidate
+    int pendingCount = 0;
+    uint64_t found = 0;
+    uint64_t nodes = 0;
+    bool exhausted = false;           // the last search ran out of its node budget
+
+    static const Tables& tables() {
+        static const Tables instance;
+        return instance;
+    }
+
+    static Mask bit(const int& k) { return static_cast<Mask>(Mask(1) << (k - 1)); }
+    static bool isSingle(const Mask& mask) { return (mask & (mask - 1)) == 0; }
+    // Same helpers as solver_engine.h, widened to the 32-bit masks of 25x25 grids
+    static int lowestDigit(Mask mask) {
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_ctz(mask) + 1;
+#else
+        int k = 1;
+        while (!(mask & 1)) { mask >>= 1; k++; }
+        return k;
+#endif
+    }
+    static int countDigits(Mask mask) {
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_popcount(mask);
+#else
+        int count = 0;
+        for (; mask; mask &= mask - 1) count++;
+        return count;
+#endif
+    }
+
+    bool load(const GridType& grid, State& state) {
+        pendingCount = 0;
+        state.cells.fill(0);
+        state.candidates.fill(Traits::ALL);
+        state.empty = CELLS;
+        for (int cell = 0; cell < CELLS; cell++) {
+            const int k = grid[cell];
+            if (k == 0) continue;
+            if (k > N || !assign(state, cell, k)) return false;
+        }
+        return propagate(state);
+    }
+
+    // Places `k`, removes it from the peers and queues the peers left with a single candidate
+    bool assign(State& state, const int& cell, const int& k) {
+        const Mask b = bit(k);
+        if (!(state.candidates[cell] & b)) return false;
+        state.cells[cell] = static_cast<uint8_t>(k);
+        state.candidates[cell] = 0;
+        state.empty--;
+        for (const uint16_t& peer : tables().peers[cell]) {
+            Mask& mask = state.candidates[peer];
+            if (!(mask & b)) continue;
+            mask = static_cast<Mask>(mask & ~b);
+            if (!mask) return false;
+            if (isSingle(mask)) pending[pendingCount++] = peer;
+        }
+        return true;
+    }
+
+    // Removes the digits of `mask` from an empty cell and queues it if a single candidate is left
+    bool eliminate(State& state, const int& cell, const Mask& mask) {
+        Mask& options = state.candidates[cell];
+        if (!(options & mask)) return true;
+        options = static_cast<Mask>(options & ~mask);
+        if (!options) return false;
+        if (isSingle(options)) pending[pendingCount++] = static_cast<uint16_t>(cell);
+        return true;
+    }
+
+    // Places every hidden single; sets progress when at least one digit was placed
+    bool applyHiddenSingles(State& state, bool& progress) {
+        for (const auto& unit : tables().units) {
+            Mask once = 0, twice = 0, placed = 0;
+            for (const uint16_t& cell : unit) {
+                if (state.cells[cell]) placed |= bit(state.cells[cell]);
+                twice |= once & state.candidates[cell];
+                once |= state.candidates[cell];
+            }
+
+            // Some digit is neither placed nor possible anywhere in the unit
+            if (static_cast<Mask>(once | placed) != Traits::ALL) return false;
+
+            const Mask exactlyOnce = static_cast<Mask>(once & ~twice);
+            if (!exactlyOnce) continue;
+
+            for (const uint16_t& cell : unit) {
+                const Mask hidden = static_cast<Mask>(state.candidates[cell] & exactlyOnce);
+                if (!hidden) continue;
+                if (!isSingle(hidden)) return false;  // One cell would need two digits
+                if (!assign(state, cell, lowestDigit(hidden))) return false;
+                progress = true;
+            }
+        }
+        return true;
+    }
+
+    // Removes pointing and claiming candidates; sets progress when a candidate was removed
+    bool applyLockedCandidates(State& state, bool& progress) {
+        constexpr int SECTIONS = 2 * N * BOX;
+        const Tables& t = tables();
+
+        // The rest of a line or a box is made of other intersections, so each segment is read once.
+        // Masks left stale by the eliminations below only hold extra digits, which hides a
+        // deduction until the next pass but never makes a wrong one.
+        Mask segments[SECTIONS];
+        for (int i = 0; i < SECTIONS; i++) {
+            segments[i] = 0;
+            for (const uint16_t& cell : t.intersections[i].segment) segments[i] |= state.candidates[cell];
+        }
+
+        for (int i = 0; i < SECTIONS; i++) {
+            if (!segments[i]) continue;
+            const Intersection& section = t.intersections[i];
+            Mask lineRest = 0, boxRest = 0;
+            for (int j = 0; j < BOX - 1; j++) {
+                lineRest |= segments[section.lineSections[j]];
+                boxRest |= segments[section.boxSections[j]];
+            }
+
+            // Pointing: inside the box the digit only fits on this line
+            const Mask pointing = static_cast<Mask>(segments[i] & ~boxRest & lineRest);
+            // Claiming: inside the line the digit only fits in this box
+            const Mask claiming = static_cast<Mask>(segments[i] & ~lineRest & boxRest);
+            if (!pointing && !claiming) continue;
+
+            for (int j = 0; j < N - BOX; j++) {
+                if (pointing && !eliminate(state, section.lineRest[j], pointing)) return false;
+                if (claiming && !eliminate(state, section.boxRest[j], claiming)) return false;
+            }
+            progress = true;
+        }
+        return true;
+    }
+
+    // Naked singles, hidden singles and locked candidates until a fixpoint; false on a contradiction
+    bool propagate(State& state) {
+        for (;;) {
+            while (pendingCount > 0) {
+                const int cell = pending[--pendingCount];
+                if (state.cells[cell]) continue;
+                if (!assign(state, cell, lowestDigit(state.candidates[cell]))) return false;
+            }
+            if (state.empty == 0) return true;
+
+            bool progress = false;
+            if (!applyHiddenSingles(state, progress)) return false;
+            if (progress || pendingCount > 0) continue;
+
+            if (!applyLockedCandidates(state, progress)) return false;
+            if (!progress && pendingCount == 0) return true;
+        }
+    }
+
+    uint64_t run(const uint64_t& limit, GridType* solution, Rng* rng, const uint64_t& node_budget) {
+        found = 0;
+        nodes = 0;
+        exhausted = !branch(0, limit, solution, rng, node_budget);
+        return exhausted ? 0 : found;
+    }
+
+    // Returns false once the node budget is exhausted
+    bool branch(const size_t& depth, const uint64_t& limit, GridType* solution, Rng* rng, const uint64_t& node_budget) {
+        if (levels[depth].empty == 0) {
+            if (found++ == 0 && solution) {
+                for (int i = 0; i < CELLS; i++) (*solution)[i] = levels[depth].cells[i];
+            }
+            return true;
+        }
+        if (node_budget && ++nodes > node_budget) return false;
+
+        // Minimum remaining values; propagation left no cell with fewer than two candidates
+        int best = -1, bestCount = N + 1;
+        for (int cell = 0; cell < CELLS && bestCount > 2; cell++) {
+            const Mask mask = levels[depth].candidates[cell];
+            if (mask && countDigits(mask) < bestCount) {
+                best = cell;
+                bestCount = countDigits(mask);
+            }
+        }
+
+        int digits[N];
+        int count = 0;
+        for (Mask mask = levels[depth].candidates[best]; mask; mask &= mask - 1) digits[count++] = lowestDigit(mask);
+        if (rng) rng->shuffle(digits, count);
+
+        if (levels.size() < depth + 2) levels.resize(depth + 2);
+        for (int i = 0; i < count && (!limit || found < limit); i++) {
+            levels[depth + 1] = levels[depth];
+            pendingCount = 0;
+            State& next = levels[depth + 1];
+            if (assign(next, best, digits[i]) && propagate(next)) {
+                if (!branch(depth + 1, limit, solution, rng, node_budget)) return false;
+            }
+        }
+        return true;
+    }
+};
+
+/**
+ * @brief Solves a grid in place.
+ *
+ * @param grid The puzzle; receives the solution when there is one.
+ * @return true if the grid was solved, false if it has no solution (the grid is then unchanged).
+ */
+template <int BOX>
+bool solveGrid(Grid<BOX>& grid) {
+    GridSolver<BOX> solver;
+    return solver.search(grid, 1, &grid) > 0;
+}
+
+/**
+ * @brief Counts the solutions of a grid.
+ *
+ * @param grid The puzzle.
+ * @param limit Stop counting once this many solutions are found (0 = count all).
+ * @return uint64_t The number of solutions, at most `limit` when a limit is set.
+ */
+template <int BOX>
+uint64_t countGridSolutions(const Grid<BOX>& grid, const uint64_t& limit = 0) {
+    GridSolver<BOX> solver;
+    return solver.search(grid, limit);
+}
+
+/**
+ * @brief Returns true if a grid is completely and validly filled.
+ */
+template <int BOX>
+bool checkGridSolution(const Grid<BOX>& grid) {
+    constexpr int N = GridTraits<BOX>::SIZE;
+    using Mask = typename GridTraits<BOX>::Mask;
+    for (int i = 0; i < N; i++) {
+        Mask row = 0, column = 0, box = 0;
+        for (int j = 0; j < N; j++) {
+            const int values[3] = {grid.at(i, j), grid.at(j, i),
+                                   grid.at((i / BOX) * BOX + j / BOX, (i % BOX) * BOX + j % BOX)};
+            for (const int& k : values) {
+                if (k < 1 || k > N) return false;
+            }
+            row |= static_cast<Mask>(Mask(1) << (values[0] - 1));
+            column |= static_cast<Mask>(Mask(1) << (values[1] - 1));
+            box |= static_cast<Mask>(Mask(1) << (values[2] - 1));
+        }
+        if (row != GridTraits<BOX>::ALL || column != GridTraits<BOX>::ALL || box != GridTraits<BOX>::ALL) return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Fills an empty grid with a random complete solution.
+ *
+ * Fills the independent diagonal boxes with shuffled digits, then completes
+ * the grid with a search that tries the digits of every branch in random
+ * order. A search that wanders into a large dead subtree is restarted from new
+ * diagonal boxes, which is much cheaper than finishing it on 25x25 grids.
+ *
+ * @param grid The grid that receives the solution.
+ * @param rng The random generator to draw from.
+ */
+template <int BOX>
+void fillGrid(Grid<BOX>& grid, Rng& rng) {
+    constexpr int N = GridTraits<BOX>::SIZE;
+    GridSolver<BOX> solver;
+    for (;;) {
+        grid = makeEmptyGrid<BOX>();
+        for (int b = 0; b < BOX; b++) {
+            int digits[N];
+            for (int k = 0; k < N; k++) digits[k] = k + 1;
+            rng.shuffle(digits, N);
+            for (int k = 0; k < N; k++) grid.at(b * BOX + k / BOX, b * BOX + k % BOX) = static_cast<uint8_t>(digits[k]);
+        }
+        if (solver.search(grid, 1, &grid, &rng, 50 * static_cast<uint64_t>(GridTraits<BOX>::CELLS))) return;
+    }
+}
+
+/**
+ * @brief Generates a puzzle by emptying cells of a random complete grid.
+ *
+ * With `unique`, cells are visited in random order and only cleared while the
+ * puzzle keeps a unique solution, as generateUniqueBoard() does; the result
+ * may then have fewer empty cells than requested. On sparse 16x16 and 25x25
+ * grids a single uniqueness check can take a very long search, so each one
+ * gets a node budget and a cell whose check runs out of it keeps its digit.
+ *
+ * @param grid The grid that receives the puzzle.
+ * @param empty_cells The requested number of empty cells.
+ * @param rng The random generator to draw from.
+ * @param unique Only clear cells that keep the solution unique (default: true).
+ * @return int The number of cells actually emptied.
+ */
+template <int BOX>
+int generateGrid(Grid<BOX>& grid, const int& empty_cells, Rng& rng, const bool& unique = true) {
+    constexpr int CELLS = GridTraits<BOX>::CELLS;
+    constexpr uint64_t UNIQUENESS_NODE_BUDGET = CELLS;
+    fillGrid<BOX>(grid, rng);
+
+    int order[CELLS];
+    for (int i = 0; i < CELLS; i++) order[i] = i;
+    rng.shuffle(order, CELLS);
+
+    GridSolver<BOX> solver;
+    int removed = 0;
+    for (int i = 0; i < CELLS && removed < empty_cells; i++) {
+        const int cell = order[i];
+        const int k = grid[cell];
+        grid[cell] = 0;
+        // The puzzle is unique before the removal, so it stays unique unless another digit fits here
+        if (unique && solver.hasSolutionExcluding(grid, cell, k, UNIQUENESS_NODE_BUDGET)) {
+            grid[cell] = static_cast<uint8_t>(k);
+        } else {
+            removed++;
+        }
+    }
+    return removed;
+}
+
+// 9x9 grids use the specialized engine (defined in grid.cpp)
+template <>
+bool solveGrid<3>(Grid<3>& grid);
+
+template <>
+uint64_t countGridSolutions<3>(const Grid<3>& grid, const uint64_t& limit);
+
+template <>
+bool checkGridSolution<3>(const Grid<3>& grid);
+
+template <>
+void fillGrid<3>(Grid<3>& grid, Rng& rng);
+
+template <>
+int generateGrid<3>(Grid<3>& grid, const int& empty_cells, Rng& rng, const bool& unique);
+
+#endif //SUDOKUPROJECT_GRID_SOLVER_H
@@ -0,0 +1,52 @@
+/**
+ * @file line_stream.h
+ * @brief Streaming solver for the one-line puzzle format.
+ *
+ * In the one-line format every puzzle is a line of 81 characters in row-major
+ * order, with `1`-`9` for givens and `0` or `.` for blanks (a trailing `\r` is
+ * accepted). The stream solver reads such lines in large chunks, solves them
+ * in batches with solveBoardsBatch() and writes one 81-character line per
+ * input line, so a multi-gigabyte dump can be piped through it in constant
+ * memory:
+ * - a solvable puzzle is replaced by its solution,
+ * - an unsolvable puzzle is written back unchanged (blanks as `.`),
+ * - a malformed line is copied as it is (a line longer than the 1 MiB read
+ *   buffer is dropped instead); empty lines are dropped.
+ *
+ * @author
+ * Keshav Bhandari
+ *
+ * @date
+ * October 16, 2026
+ */
+
+#ifndef SUDOKUPROJECT_LINE_STREAM_H
+#define SUDOKUPROJECT_LINE_STREAM_H
+
+#include <cstdint>
+#include <cstdio>
+
+/**
+ * @brief Counters reported by solveLineStream().
+ */
+struct LineStreamStats {
+    uint64_t puzzles = 0;      ///< Well-formed puzzle lines
+    uint64_t solved = 0;       ///< Puzzles written out solved
+    uint64_t unsolvable = 0;   ///< Puzzles without a solution
+    uint64_t malformed = 0;    ///< Non-empty lines that are not 81 valid cells
+};
+
+/**
+ * @brief Solves every one-line puzzle of a stream and writes the results to another stream.
+ *
+ * Input is read in chunks of 1 MiB and output is written in chunks of the
+ * same size, so memory use does not depend on the length of the stream.
+ * Output lines appear in input order.
+ *
+ * @param in The input stream (e.g. stdin or a file opened with fopen).
+ * @param out The output stream (e.g. stdout).
+ * @return LineStreamStats Counters of the processed lines.
+ */
+LineStreamStats solveLineStream(std::FILE* in, std::FILE* out);
+
+#endif //SUDOKUPROJECT_LINE_STREAM_H
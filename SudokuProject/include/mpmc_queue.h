@@ -0,0 +1,160 @@
+/**
+ * @file mpmc_queue.h
+ * @brief Bounded lock-free multi-producer multi-consumer queue.
+ *
+ * Dmitry Vyukov's bounded MPMC queue: a ring of cells, each with a sequence
+ * number that tells producers and consumers whose turn the cell is. A push or
+ * a pop is one compare-and-swap on the shared position plus a release store
+ * on the cell, and never takes a lock.
+ *
+ * The blocking push() and pop() spin briefly, then yield, then sleep, so an
+ * idle stage does not burn a core. A queue is closed by its last producer;
+ * consumers drain what is left and then see pop() return false.
+ *
+ * @author
+ * Keshav Bhandari
+ *
+ * @date
+ * October 16, 2026
+ */
+
+#ifndef SUDOKUPROJECT_MPMC_QUEUE_H
+#define SUDOKUPROJECT_MPMC_QUEUE_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <thread>
+
+/**
+ * @brief Fixed-capacity lock-free MPMC queue of copyable values.
+ */
+template <typename T>
+class BoundedQueue {
+public:
+    /**
+     * @brief Creates an empty queue.
+     *
+     * @param capacity Requested capacity, rounded up to a power of two (at least 2).
+     * @param producers Number of producers; the queue closes when all of them called producerDone().
+     */
+    explicit BoundedQueue(const size_t& capacity, const int& producers = 1)
+        : producersLeft(producers) {
+        size_t size = 2;
+        while (size < capacity) size <<= 1;
+        mask = size - 1;
+        cells.reset(new Cell[size]);
+        for (size_t i = 0; i < size; i++) cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    BoundedQueue(const BoundedQueue&) = delete;
+    BoundedQueue& operator=(const BoundedQueue&) = delete;
+
+    /**
+     * @brief Appends a value if there is room.
+     *
+     * @return true if the value was queued, false if the queue is full.
+     */
+    bool tryPush(const T& value) {
+        size_t pos = enqueuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = cells[pos & mask];
+            const size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            const std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos);
+            if (diff == 0) {
+                if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell.value = value;
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;  // The cell still holds a value from the previous lap
+            } else {
+                pos = enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @brief Removes the oldest value if there is one.
+     *
+     * @return true if a value was removed, false if the queue is empty.
+     */
+    bool tryPop(T& value) {
+        size_t pos = dequeuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = cells[pos & mask];
+            const size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            const std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos + 1);
+            if (diff == 0) {
+                if (dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    value = cell.value;
+                    cell.sequence.store(pos + mask + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;  // No producer has filled the cell yet
+            } else {
+                pos = dequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @brief Appends a value, waiting while the queue is full.
+     */
+    void push(const T& value) {
+        for (int attempt = 0; !tryPush(value); attempt++) backoff(attempt);
+    }
+
+    /**
+     * @brief Removes the oldest value, waiting while the queue is empty and still open.
+     *
+     * @return true if a value was removed, false once the queue is closed and drained.
+     */
+    bool pop(T& value) {
+        for (int attempt = 0;; attempt++) {
+            if (tryPop(value)) return true;
+            // Every push of the producers happened before the close, so one more try sees them all
+            if (closed.load(std::memory_order_acquire)) return tryPop(value);
+            backoff(attempt);
+        }
+    }
+
+    /**
+     * @brief Signals that one producer will not push any more; the last call closes the queue.
+     */
+    void producerDone() {
+        if (producersLeft.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            closed.store(true, std::memory_order_release);
+        }
+    }
+
+    /**
+     * @brief Returns the capacity of the queue.
+     */
+    size_t capacity() const { return mask + 1; }
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence;
+        T value;
+    };
+
+    // Producers and consumers update different positions, so keep them on separate cache lines
+    alignas(64) std::atomic<size_t> enqueuePos{0};
+    alignas(64) std::atomic<size_t> dequeuePos{0};
+    alignas(64) std::atomic<int> producersLeft;
+    std::atomic<bool> closed{false};
+    std::unique_ptr<Cell[]> cells;
+    size_t mask;
+
+    static void backoff(const int& attempt) {
+        if (attempt < 64) return;
+        if (attempt < 1024) std::this_thread::yield();
+        else std::this_thread::sleep_for(std::chrono::microseconds(50));
+    }
+};
+
+#endif //SUDOKUPROJECT_MPMC_QUEUE_H
@@ -0,0 +1,97 @@
+/**
+ * @file pipeline.h
+ * @brief Staged generate → solve → verify → write corpus production.
+ *
+ * The stages run concurrently and hand puzzles to each other through bounded
+ * lock-free queues (see mpmc_queue.h):
+ * 1. generators (several threads) create puzzle `i` from Rng stream `(seed, i)`,
+ *    the same puzzles createAndSaveNPuzzles() produces for that seed;
+ * 2. solvers (several threads) solve every puzzle with the selected backend;
+ * 3. a verifier checks every solution with checkIfSolutionIsValid() and
+ *    against the givens of its puzzle;
+ * 4. the calling thread writes the results, reordered by index, so the
+ *    output does not depend on the thread counts.
+ * The bounded queues keep memory use flat: a slow writer holds the other
+ * stages back instead of letting puzzles pile up, while CPU work and I/O
+ * overlap instead of running as separate passes through the filesystem.
+ * Generators also never run more than `queueCapacity` puzzles ahead of the
+ * writer, so one slow puzzle cannot fill the reorder buffer with the ones
+ * after it.
+ *
+ * @author
+ * Keshav Bhandari
+ *
+ * @date
+ * October 16, 2026
+ */
+
+#ifndef SUDOKUPROJECT_PIPELINE_H
+#define SUDOKUPROJECT_PIPELINE_H
+
+#include <cstdint>
+#include <string>
+#include "rater.h"
+#include "sudoku.h"
+
+/**
+ * @brief Output layouts of the pipeline writer.
+ */
+enum class PipelineFormat {
+    Files,    ///< One pretty file per board: `puzzles/XXXXPUZZLE.txt` and `solutions/XXXXSOLUTION.txt`
+    Line,     ///< One line per puzzle: the puzzle, or `puzzle,solution` when solving
+    Corpus    ///< A binary corpus file (see corpus.h), with solutions when solving
+};
+
+/**
+ * @brief Settings of one pipeline run.
+ */
+struct PipelineOptions {
+    int count = 10;                          ///< Number of puzzles to generate
+    int emptyBoxes = 45;                     ///< Empty cells per puzzle (ignored with a difficulty target)
+    bool unique = true;                      ///< Only generate puzzles with a unique solution
+    bool useDifficulty = false;              ///< Generate for `difficulty` instead of `emptyBoxes`
+    Difficulty difficulty = Difficulty::Medium;
+    uint64_t seed = 0;                       ///< Seed of the whole run; 0 picks a random seed
+    bool solve = true;                       ///< Run the solve and verify stages
+    SolverType solver = SolverType::Efficient;
+    int threads = 0;                         ///< Worker threads shared by generators and solvers; 0 = one per hardware thread
+    int queueCapacity = 1024;                ///< Capacity of every queue between two stages, and how far generators may run ahead of the writer
+    PipelineFormat format = PipelineFormat::Files;
+    std::string output = "data/";            ///< Base folder (Files), file or "-" for stdout (Line), or file (Corpus)
+};
+
+/**
+ * @brief Counters reported by runPipeline().
+ */
+struct PipelineStats {
+    uint64_t seed = 0;          ///< The seed actually used
+    uint64_t generated = 0;     ///< Puzzles generated
+    uint64_t offBand = 0;       ///< --difficulty runs: puzzles written outside the band after every attempt missed
+    uint64_t solved = 0;        ///< Puzzles the solver reported as solved
+    uint64_t verified = 0;      ///< Solutions that passed verification
+    uint64_t written = 0;       ///< Records written
+    double seconds = 0;         ///< Wall time of the whole run
+};
+
+/**
+ * @brief Parses a format name ("files", "line" or "corpus").
+ *
+ * @return true if the name is known, false otherwise (`format` is left unchanged).
+ */
+bool parsePipelineFormat(const std::string& name, PipelineFormat& format);
+
+/**
+ * @brief Runs the pipeline until `options.count` puzzles are written.
+ *
+ * With `options.solve` false, generated puzzles go straight to the writer.
+ * Puzzles whose solution fails verification are reported on stderr and
+ * written without a solution (Files: no solution file; Line: puzzle only;
+ * Corpus: an empty solution).
+ *
+ * @param options The run settings.
+ * @param stats Receives the counters of the run.
+ * @return true if every record was written, false on an I/O error or if a stage threw.
+ */
+bool runPipeline(const PipelineOptions& options, PipelineStats& stats);
+
+#endif //SUDOKUPROJECT_PIPELINE_H
@@ -0,0 +1,242 @@
+/**
+ * @file puzzle_set.h
+ * @brief Compact in-memory set of puzzles in structure-of-arrays layout.
+ *
+ * A PuzzleSet keeps millions of puzzles without a heap allocation per board.
+ * Puzzles are stored in chunks of PUZZLE_SET_CHUNK; every chunk holds one
+ * array per column (puzzles, and optionally solutions, per-puzzle stats and
+ * flags), so a pass over one column touches only that column's memory and
+ * adding puzzles never moves the ones already stored.
+ *
+ * Cells are either nibble-packed (41 bytes per board, the corpus record
+ * format of corpus.h) or kept as plain `Board`s (81 bytes). The byte layout
+ * costs twice the memory but hands the solvers a contiguous `Board` array
+ * with no unpacking at all.
+ *
+ * | Layout / columns           | Bytes per puzzle |
+ * |----------------------------|------------------|
+ * | Packed                     | 41               |
+ * | Packed + solutions + flags | 83               |
+ * | Bytes                      | 81               |
+ * | Bytes + solutions          | 162              |
+ * | Per-puzzle stats column    | +8               |
+ *
+ * @author
+ * Keshav Bhandari
+ *
+ * @date
+ * October 16, 2026
+ */
+
+#ifndef SUDOKUPROJECT_PUZZLE_SET_H
+#define SUDOKUPROJECT_PUZZLE_SET_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "board.h"
+
+/// Number of puzzles per chunk; a multiple of BATCH_LANES.
+constexpr size_t PUZZLE_SET_CHUNK = 1 << 16;
+
+/// Column flag: a solution is stored for every puzzle.
+constexpr uint32_t PUZZLE_SET_SOLUTIONS = 1;
+
+/// Column flag: a PuzzleStats is stored for every puzzle.
+constexpr uint32_t PUZZLE_SET_STATS = 2;
+
+/// Column flag: a byte of flags is stored for every puzzle.
+constexpr uint32_t PUZZLE_SET_FLAGS = 4;
+
+/// Puzzle flag: the puzzle was solved.
+constexpr uint8_t PUZZLE_SOLVED = 1;
+
+/// Puzzle flag: the puzzle was found to have no solution.
+constexpr uint8_t PUZZLE_UNSOLVABLE = 2;
+
+/**
+ * @brief How the cells of the puzzle and solution columns are stored.
+ */
+enum class CellLayout {
+    Packed,   ///< Two cells per byte, 41 bytes per board (see packBoard())
+    Bytes     ///< One `Board` per puzzle, 81 bytes, usable by the solvers in place
+};
+
+/**
+ * @brief Search counters of one solve, small enough to keep for every puzzle.
+ */
+struct PuzzleStats {
+    uint32_t nodes = 0;        ///< Search nodes visited
+    uint32_t backtracks = 0;   ///< Choices that were tried and undone
+};
+
+/**
+ * @brief A view of the contiguous puzzles of one chunk.
+ *
+ * Columns that the set does not store, and the cell arrays of the other
+ * layout, are nullptr. The pointers stay valid until the set is cleared or destroyed.
+ */
+struct PuzzleBlock {
+    size_t first = 0;                     ///< Index of the first puzzle of the block in the set
+    size_t count = 0;                     ///< Number of puzzles in the block
+    uint8_t* packedPuzzles = nullptr;     ///< Packed layout: count * PACKED_BOARD_SIZE bytes
+    uint8_t* packedSolutions = nullptr;   ///< Packed layout with solutions
+    Board* puzzles = nullptr;             ///< Byte layout: count boards
+    Board* solutions = nullptr;           ///< Byte layout with solutions
+    PuzzleStats* stats = nullptr;
+    uint8_t* flags = nullptr;
+};
+
+/**
+ * @brief Chunked structure-of-arrays storage for a large number of puzzles.
+ */
+class PuzzleSet {
+public:
+    /**
+     * @brief Creates an empty set.
+     *
+     * @param layout How cells are stored (default: Packed).
+     * @param columns Combination of PUZZLE_SET_SOLUTIONS, PUZZLE_SET_STATS and PUZZLE_SET_FLAGS (default: 0).
+     */
+    explicit PuzzleSet(const CellLayout& layout = CellLayout::Packed, const uint32_t& columns = 0);
+
+    PuzzleSet(PuzzleSet&&) = default;
+    PuzzleSet& operator=(PuzzleSet&&) = default;
+    PuzzleSet(const PuzzleSet&) = delete;
+    PuzzleSet& operator=(const PuzzleSet&) = delete;
+
+    CellLayout layout() const { return cellLayout; }
+    uint32_t columns() const { return columnFlags; }
+    bool hasSolutions() const { return (columnFlags & PUZZLE_SET_SOLUTIONS) != 0; }
+    bool hasStats() const { return (columnFlags & PUZZLE_SET_STATS) != 0; }
+    bool hasFlags() const { return (columnFlags & PUZZLE_SET_FLAGS) != 0; }
+
+    /**
+     * @brief Returns the number of puzzles.
+     */
+    size_t size() const { return count; }
+
+    /**
+     * @brief Returns the storage of one puzzle across all its columns.
+     */
+    size_t bytesPerPuzzle() const;
+
+    /**
+     * @brief Returns the bytes allocated for the columns (whole chunks, including unused slots).
+     */
+    size_t memoryUsage() const { return chunks.size() * PUZZLE_SET_CHUNK * bytesPerPuzzle(); }
+
+    /**
+     * @brief Appends a puzzle; its solution, stats and flags start zeroed.
+     *
+     * @return size_t The index of the new puzzle.
+     */
+    size_t add(const Board& puzzle);
+
+    /**
+     * @brief Appends a puzzle given in the packed format of packBoard().
+     *
+     * @param packed PACKED_BOARD_SIZE bytes.
+     * @param packedSolution Optional packed solution, stored if the set keeps solutions (may be nullptr).
+     * @return size_t The index of the new puzzle.
+     */
+    size_t addPacked(const uint8_t* packed, const uint8_t* packedSolution = nullptr);
+
+    /**
+     * @brief Removes every puzzle and releases the chunks.
+     */
+    void clear();
+
+    /**
+     * @brief Reads puzzle `index` into a board.
+     */
+    void puzzle(const size_t& index, Board& board) const;
+
+    /**
+     * @brief Reads the solution of puzzle `index`.
+     *
+     * @return true if the set stores solutions, false otherwise (the board is left unchanged).
+     */
+    bool solution(const size_t& index, Board& board) const;
+
+    /**
+     * @brief Stores the solution of puzzle `index`.
+     *
+     * @return true if the set stores solutions, false otherwise.
+     */
+    bool setSolution(const size_t& index, const Board& board);
+
+    /**
+     * @brief Returns the stats of puzzle `index`, or nullptr if the set does not store stats.
+     */
+    PuzzleStats* stats(const size_t& index);
+
+    /**
+     * @brief Returns the flags of puzzle `index` (0 if the set does not store flags).
+     */
+    uint8_t flags(const size_t& index) const;
+
+    /**
+     * @brief Sets the flags of puzzle `index`; ignored if the set does not store flags.
+     */
+    void setFlags(const size_t& index, const uint8_t& value);
+
+    /**
+     * @brief Returns the number of blocks, i.e. of chunks in use.
+     */
+    size_t blockCount() const { return chunks.size(); }
+
+    /**
+     * @brief Returns a view of the puzzles of chunk `index`.
+     */
+    PuzzleBlock block(const size_t& index) const;
+
+private:
+    struct Chunk {
+        std::unique_ptr<uint8_t[]> packedPuzzles;
+        std::unique_ptr<uint8_t[]> packedSolutions;
+        std::unique_ptr<Board[]> puzzles;
+        std::unique_ptr<Board[]> solutions;
+        std::unique_ptr<PuzzleStats[]> stats;
+        std::unique_ptr<uint8_t[]> flags;
+    };
+
+    CellLayout cellLayout;
+    uint32_t columnFlags;
+    size_t count = 0;
+    std::vector<Chunk> chunks;
+
+    size_t append();
+};
+
+/**
+ * @brief Solves every puzzle of a set in place of its solution column.
+ *
+ * Puzzles go through solveBoardsBatch() in groups of BATCH_LANES; in the byte
+ * layout the group is copied straight into the solution column and solved
+ * there. When the set keeps stats, every puzzle is solved on its own by the
+ * instrumented solveBoardEfficient() instead, so each gets its own counters.
+ * Solutions, stats and the PUZZLE_SOLVED / PUZZLE_UNSOLVABLE flags are written
+ * to whichever of those columns the set stores. The solution of a puzzle that
+ * has none is stored as an all-zero board, in both layouts.
+ *
+ * @param set The puzzles to solve.
+ * @param threads Number of worker threads; 0 means one per hardware thread (default: 1).
+ * @return size_t The number of puzzles solved.
+ */
+size_t solvePuzzleSet(PuzzleSet& set, const int& threads = 1);
+
+/**
+ * @brief Appends the records of a corpus file (see corpus.h) to a set.
+ *
+ * Solutions are copied if both the corpus and the set store them.
+ *
+ * @param filename Path of the corpus file.
+ * @param set The set that receives the puzzles.
+ * @return true if the corpus was read, false otherwise.
+ */
+bool loadPuzzleSet(const std::string& filename, PuzzleSet& set);
+
+#endif //SUDOKUPROJECT_PUZZLE_SET_H
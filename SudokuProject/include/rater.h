@@ -0,0 +1,105 @@
+/**
+ * @file rater.h
+ * @brief Technique-based difficulty rating of Sudoku puzzles.
+ *
+ * The rater solves a puzzle the way a person would: at every step it applies
+ * the easiest human technique that makes progress, then starts again from the
+ * easiest one. It records the hardest technique that was needed and a score
+ * (the sum of the weights of all applied steps), and never guesses. Puzzles
+ * that the techniques cannot finish are reported as needing a guess.
+ *
+ * Techniques, from easiest to hardest:
+ * - Hidden and naked singles.
+ * - Locked candidates (pointing and claiming).
+ * - Naked and hidden pairs and triples.
+ * - X-wing and swordfish.
+ *
+ * The rater runs on the incremental SearchState of solver_engine.h and does
+ * not allocate, so it grades thousands of puzzles per second.
+ *
+ * @author
+ * Keshav Bhandari
+ *
+ * @date
+ * October 16, 2026
+ */
+
+#ifndef SUDOKUPROJECT_RATER_H
+#define SUDOKUPROJECT_RATER_H
+
+#include "board.h"
+
+/**
+ * @brief Human solving techniques, ordered from easiest to hardest.
+ */
+enum class Technique {
+    None,               ///< Nothing was needed (the board was already full)
+    HiddenSingle,       ///< A digit fits in only one cell of a unit
+    NakedSingle,        ///< A cell has only one candidate
+    LockedCandidates,   ///< Pointing and claiming on box/line intersections
+    NakedPair,          ///< Two cells of a unit share the same two candidates
+    HiddenPair,         ///< Two digits of a unit fit only in the same two cells
+    NakedTriple,        ///< Three cells of a unit hold only three candidates
+    HiddenTriple,       ///< Three digits of a unit fit only in the same three cells
+    XWing,              ///< A digit confined to the same two columns in two rows (or vice versa)
+    Swordfish,          ///< The same pattern over three rows and three columns
+    Guessing            ///< The techniques above are not enough
+};
+
+/**
+ * @brief Difficulty bands derived from the hardest technique of a rating.
+ */
+enum class Difficulty {
+    Easy,       ///< Singles only
+    Medium,     ///< Needs locked candidates
+    Hard,       ///< Needs pairs or triples
+    Expert,     ///< Needs X-wing or swordfish
+    Extreme     ///< Cannot be finished without guessing
+};
+
+/**
+ * @brief Result of ratePuzzle().
+ */
+struct DifficultyRating {
+    Technique hardest = Technique::None;    ///< Hardest technique applied (Guessing if the rater got stuck)
+    int score = 0;                          ///< Sum of the weights of all applied steps
+    int steps = 0;                          ///< Number of technique applications
+    bool solved = false;                    ///< Whether the techniques alone completed the board
+};
+
+/**
+ * @brief Returns the display name of a technique (e.g. "X-wing").
+ */
+const char* getTechniqueName(const Technique& technique);
+
+/**
+ * @brief Returns the display name of a difficulty band (e.g. "medium").
+ */
+const char* getDifficultyName(const Difficulty& difficulty);
+
+/**
+ * @brief Returns the weight that one application of a technique adds to the score.
+ */
+int getTechniqueWeight(const Technique& technique);
+
+/**
+ * @brief Rates a puzzle by solving it with human techniques only.
+ *
+ * At every step the easiest technique that makes progress is applied once
+ * (singles place every single they find in one sweep, each counted as a step),
+ * then the search for a technique restarts from the easiest one.
+ *
+ * The rating is only meaningful for puzzles with a unique solution; puzzles
+ * with several solutions, or contradictory givens, end with `solved == false`.
+ *
+ * @param board The puzzle to rate (left unchanged).
+ * @return DifficultyRating The hardest technique, score and step count.
+ */
+DifficultyRating ratePuzzle(const Board& board);
+
+/**
+ * @brief Maps a rating to its difficulty band.
+ */
+Difficulty classifyDifficulty(const DifficultyRating& rating);
+
+#endif //SUDOKUPROJECT_RATER_H
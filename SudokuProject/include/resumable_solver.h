@@ -0,0 +1,140 @@
+/**
+ * @file resumable_solver.h
+ * @brief Iterative, budget-limited and cancellable Sudoku solver.
+ *
+ * solveBoard() and solveBoardEfficient() recurse and always run to the end,
+ * so one adversarial puzzle can hold a worker for as long as its search
+ * takes. ResumableSolver runs the same MRV search with constraint propagation
+ * as solveBoardEfficient(), but keeps its choice points on an explicit stack
+ * inside the solver object. A call to run() stops when its node budget or
+ * time budget is spent, or when a CancellationToken is cancelled, and a later
+ * call continues exactly where the previous one stopped.
+ *
+ * @author
+ * Keshav Bhandari
+ *
+ * @date
+ * October 16, 2026
+ */
+
+#ifndef SUDOKUPROJECT_RESUMABLE_SOLVER_H
+#define SUDOKUPROJECT_RESUMABLE_SOLVER_H
+
+#include <atomic>
+#include <cstdint>
+#include "board.h"
+#include "solver_engine.h"
+
+/**
+ * @brief Outcome of a budget-limited solve.
+ */
+enum class SolveStatus {
+    Solved,          ///< A solution was found
+    Unsolvable,      ///< The search space is exhausted without a solution
+    BudgetExceeded   ///< The search stopped early and can be resumed
+};
+
+/**
+ * @brief Returns the display name of a status ("solved", "unsolvable" or "budget exceeded").
+ */
+const char* getSolveStatusName(const SolveStatus& status);
+
+/**
+ * @brief A flag that asks running searches to stop, safe to set from any thread.
+ */
+class CancellationToken {
+public:
+    void cancel() { cancelled.store(true, std::memory_order_relaxed); }
+    void reset() { cancelled.store(false, std::memory_order_relaxed); }
+    bool isCancelled() const { return cancelled.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<bool> cancelled{false};
+};
+
+/**
+ * @brief Limits of one call to ResumableSolver::run().
+ */
+struct SolveBudget {
+    uint64_t maxNodes = 0;                       ///< Guesses allowed in this call; 0 = no limit
+    uint64_t maxMicros = 0;                      ///< Wall-clock time allowed in this call; 0 = no limit
+    const CancellationToken* cancel = nullptr;   ///< Stops the search once cancelled (may be nullptr)
+};
+
+/**
+ * @brief MRV search whose whole state lives in the object, so it can be paused and resumed.
+ *
+ * The object holds a SearchState (a few kilobytes) and is meant to be reused:
+ * reset() starts a new puzzle without allocating.
+ */
+class ResumableSolver {
+public:
+    ResumableSolver() = default;
+
+    /**
+     * @brief Starts the search of a board.
+     */
+    explicit ResumableSolver(const Board& board) { reset(board); }
+
+    /**
+     * @brief Discards the current search and starts the search of a board.
+     *
+     * Contradictory givens, or givens that propagation alone refutes, finish
+     * the search right away with SolveStatus::Unsolvable.
+     */
+    void reset(const Board& board);
+
+    /**
+     * @brief Searches until the puzzle is decided or the budget runs out.
+     *
+     * Cancellation is checked before every guess and the clock every few
+     * guesses, so a call overshoots its time budget by a few microseconds at
+     * most. Once the search is
+     * decided, further calls return the same status immediately.
+     *
+     * @param budget The limits of this call.
+     * @return SolveStatus Solved or Unsolvable once decided, BudgetExceeded if the search can be resumed.
+     */
+    SolveStatus run(const SolveBudget& budget = SolveBudget());
+
+    /**
+     * @brief Returns the status of the search: BudgetExceeded from reset() until run() decides it.
+     */
+    SolveStatus status() const { return current; }
+
+    /**
+     * @brief Returns the solved board once status() is Solved.
+     */
+    const Board& solution() const { return state.board; }
+
+    /**
+     * @brief Returns the guesses made since reset(), over all calls to run().
+     */
+    uint64_t nodes() const { return nodeCount; }
+
+private:
+    // One choice point: the cell being guessed, its untried digits and the trail position before the guess
+    struct Frame {
+        uint8_t cell;
+        uint16_t untried;
+        int mark;
+    };
+
+    SearchState state;
+    Frame frames[81];
+    int depth = 0;
+    bool needCell = true;      // The last guess propagated cleanly; the next cell must be chosen
+    SolveStatus current = SolveStatus::Unsolvable;
+    uint64_t nodeCount = 0;
+};
+
+/**
+ * @brief Solves a board within a budget.
+ *
+ * @param board The Sudoku board, replaced by its solution when the result is Solved.
+ * @param budget The limits of the search.
+ * @return SolveStatus The outcome of the search.
+ */
+SolveStatus solveBoardBounded(Board& board, const SolveBudget& budget);
+
+#endif //SUDOKUPROJECT_RESUMABLE_SOLVER_H
@@ -0,0 +1,140 @@
+/**
+ * @file solution_cache.h
+ * @brief Bounded concurrent cache of solved puzzles, keyed by canonical form.
+ *
+ * Every isomorph of a cached puzzle hits the same entry: the puzzle is
+ * canonicalized (see canonical.h), the cached solution of the canonical form
+ * is looked up, and the hit is mapped back through the recorded transform.
+ * The cache is split into shards, each with its own mutex and LRU list, so
+ * threads solving different puzzles rarely wait on each other.
+ *
+ * @author
+ * Keshav Bhandari
+ *
+ * @date
+ * October 16, 2026
+ */
+
+#ifndef SUDOKUPROJECT_SOLUTION_CACHE_H
+#define SUDOKUPROJECT_SOLUTION_CACHE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "board.h"
+#include "sudoku.h"
+
+/**
+ * @brief A thread-safe map from canonical puzzles to their solutions, with least-recently-used eviction.
+ */
+class SolutionCache {
+public:
+    /**
+     * @brief Creates an empty cache.
+     *
+     * @param capacity Most entries kept in total, spread evenly over the shards.
+     * @param shards Number of independently locked shards.
+     */
+    explicit SolutionCache(const size_t& capacity = 1 << 16, const int& shards = 16);
+
+    SolutionCache(const SolutionCache&) = delete;
+    SolutionCache& operator=(const SolutionCache&) = delete;
+
+    /**
+     * @brief Looks up the solution of a canonical puzzle.
+     *
+     * @param canonical The puzzle in canonical form.
+     * @param solution Receives the solution of the canonical form on a hit.
+     * @return true on a hit, false on a miss.
+     */
+    bool find(const Board& canonical, Board& solution);
+
+    /**
+     * @brief Stores the solution of a canonical puzzle, evicting the least recently used entry of a full shard.
+     */
+    void insert(const Board& canonical, const Board& solution);
+
+    /**
+     * @brief Returns the number of cached entries.
+     */
+    size_t size() const;
+
+    /**
+     * @brief Returns the number of lookups that hit.
+     */
+    uint64_t hits() const { return hitCount.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Returns the number of lookups that missed.
+     */
+    uint64_t misses() const { return missCount.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Removes every entry and resets the counters.
+     */
+    void clear();
+
+private:
+    struct BoardHash {
+        size_t operator()(const Board& board) const;
+    };
+
+    using Entry = std::pair<Board, Board>;   // Canonical puzzle, solution
+
+    struct Shard {
+        mutable std::mutex mutex;
+        std::list<Entry> entries;            // Most recently used first
+        std::unordered_map<Board, std::list<Entry>::iterator, BoardHash> index;
+    };
+
+    std::vector<std::unique_ptr<Shard>> shards;
+    size_t shardCapacity;
+    std::atomic<uint64_t> hitCount{0};
+    std::atomic<uint64_t> missCount{0};
+
+    Shard& shardOf(const Board& canonical);
+};
+
+/**
+ * @brief Solves boards through a solution cache.
+ *
+ * Every board with at least 17 givens is canonicalized and looked up; hits
+ * are answered from the cache. The misses are handed to `solveMisses` in one
+ * call, so a batch solver still sees them together, and every miss it solves
+ * is cached. Boards with fewer than 17 givens skip the cache.
+ *
+ * @param boards Array of `count` boards, each solved in place.
+ * @param count Number of boards.
+ * @param solved Optional array of `count` flags receiving whether each board was solved (may be nullptr).
+ * @param cache The cache to consult and fill.
+ * @param solveMisses Solves `n` boards in place and sets their `n` solved flags.
+ * @return int The number of boards that were solved.
+ */
+int solveThroughCache(Board* boards, const int& count, bool* solved, SolutionCache& cache,
+                      const std::function<void(Board*, int, bool*)>& solveMisses);
+
+/**
+ * @brief Solves a board, consulting a solution cache first.
+ *
+ * Canonicalization costs a few hundred microseconds, more than
+ * solveBoardEfficient() spends on most puzzles, so the cache pays off for
+ * hard puzzles and for slower backends on workloads that see the same
+ * puzzles (or isomorphs of them) again.
+ * Boards with fewer than 17 givens have no unique solution and are solved
+ * directly without touching the cache.
+ *
+ * @param board The Sudoku board, solved in place.
+ * @param solver The backend used on a cache miss.
+ * @param cache The cache to consult and fill.
+ * @return true if the board is solvable, false otherwise.
+ */
+bool solve(Board& board, const SolverType& solver, SolutionCache& cache);
+
+#endif //SUDOKUPROJECT_SOLUTION_CACHE_H
@@ -0,0 +1,302 @@
+/**
+ * @file solver_engine.h
+ * @brief Bitmask candidate engine shared by the Sudoku solvers.
+ *
+ * This header declares the data structures and helpers used by the solvers to
+ * track which digits are still available in each row, column and 3x3 box.
+ * It includes:
+ * - Digit/bit conversion helpers and bit-counting utilities.
+ * - A `CandidateMasks` structure holding a 9-bit used-digit mask per unit.
+ * - O(1) place/remove operations and single-step candidate lookup.
+ * - A `SearchState` that keeps per-cell candidates, MRV buckets and an undo
+ *   trail so that a search can place digits and backtrack incrementally.
+ * - A constraint-propagation step (naked singles, hidden singles and locked
+ *   candidates) that runs on a SearchState until a fixpoint.
+ *
+ * Digit `k` (1-9) is stored as bit `k - 1`, so a mask of `0x1FF` means that
+ * all nine digits are present (or available, depending on the mask).
+ *
+ * @author
+ * Keshav Bhandari
+ *
+ * @date
+ * October 16, 2026
+ */
+
+#ifndef SUDOKUPROJECT_SOLVER_ENGINE_H
+#define SUDOKUPROJECT_SOLVER_ENGINE_H
+
+#include <cstdint>
+#include "board.h"
+
+/// Mask with one bit set for each of the nine digits.
+constexpr uint16_t ALL_DIGITS = 0x1FF;
+
+/**
+ * @brief Returns the mask bit that represents digit `k`.
+ *
+ * @param k Digit between 1 and 9.
+ * @return uint16_t A mask with only bit `k - 1` set.
+ */
+inline uint16_t digitBit(const int& k) {
+    return static_cast<uint16_t>(1u << (k - 1));
+}
+
+/**
+ * @brief Counts the number of digits contained in a mask.
+ *
+ * @param mask A 9-bit digit mask.
+ * @return int The number of set bits.
+ */
+inline int countDigits(uint16_t mask) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcount(mask);
+#else
+    int count = 0;
+    for (; mask; mask &= mask - 1) count++;
+    return count;
+#endif
+}
+
+/**
+ * @brief Returns the smallest digit contained in a non-empty mask.
+ *
+ * @param mask A non-zero 9-bit digit mask.
+ * @return int The digit (1-9) of the lowest set bit.
+ */
+inline int lowestDigit(uint16_t mask) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctz(mask) + 1;
+#else
+    int k = 1;
+    while (!(mask & 1)) { mask >>= 1; k++; }
+    return k;
+#endif
+}
+
+/**
+ * @brief Returns the index (0-8) of the 3x3 box containing cell `(r, c)`.
+ */
+inline int boxIndex(const int& r, const int& c) {
+    return (r / 3) * 3 + c / 3;
+}
+
+/**
+ * @brief Used-digit masks for every row, column and 3x3 box of a board.
+ *
+ * Bit `k - 1` of `rows[r]` is set when digit `k` is already placed somewhere in
+ * row `r`; the same holds for `cols` and `boxes`. The candidates of an empty
+ * cell are therefore the complement of the three masks covering it.
+ */
+struct CandidateMasks {
+    uint16_t rows[9];
+    uint16_t cols[9];
+    uint16_t boxes[9];
+};
+
+/**
+ * @brief Builds the used-digit masks from the current content of a board.
+ *
+ * Scans the board once and records every placed digit in its row, column and
+ * box masks. A digit that appears twice in the same unit makes the board
+ * contradictory, in which case the function returns false.
+ *
+ * @param board The Sudoku board.
+ * @param masks The masks to initialize.
+ * @return true if the givens are consistent, false if any unit repeats a digit.
+ */
+bool initCandidateMasks(const Board& board, CandidateMasks& masks);
+
+/**
+ * @brief Returns the digits that can still be placed at cell `(r, c)`.
+ *
+ * @param masks The used-digit masks of the board.
+ * @param r Row index of the cell.
+ * @param c Column index of the cell.
+ * @return uint16_t A 9-bit mask of the remaining candidates.
+ */
+inline uint16_t getCandidates(const CandidateMasks& masks, const int& r, const int& c) {
+    return static_cast<uint16_t>(~(masks.rows[r] | masks.cols[c] | masks.boxes[boxIndex(r, c)]) & ALL_DIGITS);
+}
+
+/**
+ * @brief Records digit `k` as placed at cell `(r, c)`.
+ */
+inline void placeDigit(CandidateMasks& masks, const int& r, const int& c, const int& k) {
+    const uint16_t bit = digitBit(k);
+    masks.rows[r] |= bit;
+    masks.cols[c] |= bit;
+    masks.boxes[boxIndex(r, c)] |= bit;
+}
+
+/**
+ * @brief Undoes a previous placeDigit() of digit `k` at cell `(r, c)`.
+ */
+inline void removeDigit(CandidateMasks& masks, const int& r, const int& c, const int& k) {
+    const uint16_t bit = static_cast<uint16_t>(~digitBit(k));
+    masks.rows[r] &= bit;
+    masks.cols[c] &= bit;
+    masks.boxes[boxIndex(r, c)] &= bit;
+}
+
+// ========================= Incremental Search State ==========================
+
+/**
+ * @brief Cells of one box/line intersection and of the two units it splits.
+ *
+ * `segment` holds the 3 cells shared by a box and a row (or column),
+ * `lineRest` the other 6 cells of that row/column and `boxRest` the other 6
+ * cells of that box.
+ */
+struct Intersection {
+    uint8_t segment[3];
+    uint8_t lineRest[6];
+    uint8_t boxRest[6];
+};
+
+/**
+ * @brief Precomputed cell relations of the 9x9 grid.
+ *
+ * - `peers[i]` lists the 20 cells that share a row, column or box with cell `i`.
+ * - `units[u]` lists the 9 cells of unit `u`: rows 0-8, columns 9-17, boxes 18-26.
+ * - `intersections` lists the 54 box/line intersections used for locked candidates.
+ *
+ * All cells are given as row-major indices.
+ */
+struct EngineTables {
+    uint8_t peers[81][20];
+    uint8_t units[27][9];
+    Intersection intersections[54];
+};
+
+/**
+ * @brief Returns the shared EngineTables, built once on first use.
+ */
+const EngineTables& engineTables();
+
+/**
+ * @brief Returns the index of the lowest set bit of a non-zero 64-bit word.
+ */
+inline int lowestBitIndex(uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(word);
+#else
+    int index = 0;
+    while (!(word & 1)) { word >>= 1; index++; }
+    return index;
+#endif
+}
+
+/**
+ * @brief One recorded change of a SearchState, used to backtrack.
+ *
+ * When `digit` is non-zero the entry records that `digit` was assigned to
+ * `cell`, whose candidate mask was `mask` before. Otherwise it records that
+ * candidates were removed from `cell`, whose mask was `mask` before.
+ */
+struct TrailEntry {
+    uint8_t cell;
+    uint8_t digit;
+    uint16_t mask;
+};
+
+/// Upper bound of trail entries: every entry removes at least one of the 729 candidates or fills one of the 81 cells.
+constexpr int MAX_TRAIL_SIZE = 729 + 81;
+
+/**
+ * @brief Incremental solver state with MRV buckets and an undo trail.
+ *
+ * - `candidates[i]` holds the remaining candidates of empty cell `i` (0 for filled cells).
+ * - `buckets[n]` is an 81-bit set (two words) of the empty cells that have exactly `n` candidates,
+ *   so the minimum-remaining-values cell is found with a handful of bit scans.
+ * - Every change is pushed on `trail`; undoTrail() pops entries to restore an earlier state.
+ */
+struct SearchState {
+    Board board;
+    CandidateMasks masks;
+    uint16_t candidates[81];
+    uint64_t buckets[10][2];
+    TrailEntry trail[MAX_TRAIL_SIZE];
+    int trailSize;
+    int emptyCount;
+};
+
+/**
+ * @brief Builds a SearchState from a board.
+ *
+ * @param state The state to initialize.
+ * @param board The Sudoku board to solve.
+ * @return true if the givens are consistent, false if any unit repeats a digit.
+ */
+bool initSearchState(SearchState& state, const Board& board);
+
+/**
+ * @brief Picks the empty cell with the fewest candidates.
+ *
+ * Ties are broken by the lowest row-major index. A cell with zero candidates
+ * is returned first, which lets the caller backtrack immediately.
+ *
+ * @param state The current search state.
+ * @return int The row-major index of the chosen cell, or -1 if the board is full.
+ */
+inline int selectCell(const SearchState& state) {
+    for (int n = 0; n <= 9; n++) {
+        if (state.buckets[n][0]) return lowestBitIndex(state.buckets[n][0]);
+        if (state.buckets[n][1]) return 64 + lowestBitIndex(state.buckets[n][1]);
+    }
+    return -1;
+}
+
+/**
+ * @brief Places digit `k` at `cell` and removes it from the candidates of all peers.
+ *
+ * All changes are pushed on the trail, so undoTrail() can revert them even when
+ * the function reports a contradiction.
+ *
+ * @param state The current search state.
+ * @param cell Row-major index of an empty cell.
+ * @param k Digit to place (must be a candidate of the cell).
+ * @return false if some peer is left without candidates, true otherwise.
+ */
+bool assignDigit(SearchState& state, const int& cell, const int& k);
+
+/**
+ * @brief Reverts every change recorded after trail position `mark`.
+ *
+ * @param state The current search state.
+ * @param mark A value of `state.trailSize` saved before the changes were made.
+ */
+void undoTrail(SearchState& state, const int& mark);
+
+/**
+ * @brief Removes the digits in `digits` from the candidates of an empty cell.
+ *
+ * The change is pushed on the trail. Digits that are not candidates of the cell are ignored.
+ *
+ * @param state The current search state.
+ * @param cell Row-major index of an empty cell.
+ * @param digits Mask of the digits to remove.
+ * @return false if the cell is left without candidates, true otherwise.
+ */
+bool eliminateCandidates(SearchState& state, const int& cell, const uint16_t& digits);
+
+/**
+ * @brief Applies logical deductions until nothing changes any more.
+ *
+ * Repeats the following rules until a fixpoint is reached:
+ * 1. Naked singles: a cell with a single candidate receives it.
+ * 2. Hidden singles: a digit that fits in only one cell of a unit is placed there.
+ * 3. Locked candidates: a digit confined to one row/column inside a box is removed
+ *    from the rest of that row/column (pointing), and a digit confined to one box
+ *    inside a row/column is removed from the rest of that box (claiming).
+ *
+ * Every change is pushed on the trail, so the caller can undo the whole pass
+ * with undoTrail().
+ *
+ * @param state The current search state.
+ * @return false if a contradiction was found (a cell or a digit of a unit has
+ *         no possible place left), true otherwise.
+ */
+bool propagate(SearchState& state);
+
+#endif //SUDOKUPROJECT_SOLVER_ENGINE_H
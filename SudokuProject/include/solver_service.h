@@ -0,0 +1,102 @@
+/**
+ * @file solver_service.h
+ * @brief Long-running solver service with micro-batched requests.
+ *
+ * The service keeps the solver tables and a worker pool warm and answers
+ * puzzles sent over a Unix domain socket, or over stdin/stdout for testing,
+ * so a solve costs microseconds instead of a process start and a round trip
+ * through the `data/` folders.
+ *
+ * Protocol: every message, in both directions, is a frame made of a 4-byte
+ * big-endian payload length followed by the payload (at most
+ * SERVICE_MAX_FRAME bytes). Request payloads are ASCII:
+ * - `solve <puzzle>`: answered with `solved <us> <solution>` or `unsolvable <us>`,
+ *   or `exceeded <us>` when the search runs out of `solveBudgetMicros`;
+ * - `validate <puzzle>`: answered with `unique <us>`, `multiple <us>` or `unsolvable <us>`;
+ * - `stats`: answered with `stats requests <n> batches <n> mean_us <t> max_us <t>`,
+ *   followed by ` cache_hits <n> cache_misses <n>` when the service keeps a cache;
+ * - `ping`: answered with `pong`.
+ * `<puzzle>` is any text parseBoard() accepts (e.g. the 81-character line
+ * format); `<solution>` is written as one 81-character line; `<us>` is the
+ * latency of the request in microseconds, from the moment its frame was read
+ * until its response was ready. A malformed request is answered with
+ * `error <us> <message>`; an oversized frame is answered with
+ * `error <us> frame too large` and ends the connection. If a solver throws,
+ * the solve and validate requests of its batch get `error <us> solver failed: <what>`.
+ *
+ * Responses come back in request order on every connection, so clients can
+ * pipeline requests without tagging them. Every connection has a reader and a
+ * writer thread, and the dispatcher only hands responses over to the writer,
+ * so a client that does not read its responses never stalls the others: it is
+ * disconnected once it leaves 1 MiB of responses unread or a send to it blocks
+ * for 5 seconds.
+ *
+ * Batching: readers queue parsed requests on a lock-free queue. A dispatcher
+ * takes the first waiting request, collects whatever else arrives within
+ * `maxDelayMicros` (up to `maxBatch` requests), and solves the batch on the
+ * pool: solves go through solveBoardsBatch() in groups of BATCH_LANES,
+ * validations through countSolutions(). A batch of a single group runs on the
+ * dispatcher itself, so a lone request never pays for a pool hand-off; a lone
+ * solve that is still undecided after a few hundred guesses moves to
+ * solveBoardParallel() on the pool, so one hard puzzle uses every worker. With a
+ * solve budget, solves run one by one through ResumableSolver instead, so a
+ * runaway puzzle is cut off instead of holding up the rest of its batch.
+ * With a cache capacity, every solve first goes through a SolutionCache (see
+ * solveThroughCache()), so repeated puzzles and their isomorphs are answered
+ * without a search.
+ *
+ * @author
+ * Keshav Bhandari
+ *
+ * @date
+ * October 16, 2026
+ */
+
+#ifndef SUDOKUPROJECT_SOLVER_SERVICE_H
+#define SUDOKUPROJECT_SOLVER_SERVICE_H
+
+#include <cstdint>
+#include <string>
+
+/// Largest payload accepted in a request frame.
+constexpr uint32_t SERVICE_MAX_FRAME = 4096;
+
+/**
+ * @brief Settings of the solver service.
+ */
+struct ServiceOptions {
+    std::string socketPath;      ///< Unix socket to listen on; empty serves stdin/stdout
+    int threads = 0;             ///< Pool workers; 0 = one per hardware thread
+    int maxBatch = 64;           ///< Most requests solved in one batch
+    int maxDelayMicros = 20;     ///< How long a partial batch waits for more requests
+    int queueCapacity = 4096;    ///< Requests waiting for a batch before readers block
+    int solveBudgetMicros = 0;   ///< Search time allowed per solve request; 0 = no limit
+    int cacheCapacity = 0;       ///< Solutions kept in a SolutionCache for solve requests; 0 = no cache
+};
+
+/**
+ * @brief Counters of a service run.
+ */
+struct ServiceStats {
+    uint64_t requests = 0;       ///< Requests answered (including errors)
+    uint64_t batches = 0;        ///< Batches dispatched
+    uint64_t connections = 0;    ///< Connections accepted (1 in stdin/stdout mode)
+    double totalMicros = 0;      ///< Sum of the request latencies
+    double maxMicros = 0;        ///< Largest request latency
+    uint64_t cacheHits = 0;      ///< Solve requests answered from the solution cache
+    uint64_t cacheMisses = 0;    ///< Cache lookups that missed
+};
+
+/**
+ * @brief Runs the service until stdin reaches end of file, or until SIGINT or SIGTERM in socket mode.
+ *
+ * In socket mode a stale socket file at `socketPath` is replaced, and the
+ * file is removed again on exit.
+ *
+ * @param options The service settings.
+ * @param stats Receives the counters of the run.
+ * @return true if the service ran and shut down cleanly, false if it could not start.
+ */
+bool runSolverService(const ServiceOptions& options, ServiceStats& stats);
+
+#endif //SUDOKUPROJECT_SOLVER_SERVICE_H
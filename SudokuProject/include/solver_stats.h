@@ -0,0 +1,106 @@
+/**
+ * @file solver_stats.h
+ * @brief Search counters filled by the instrumented solver overloads.
+ *
+ * The searches of the solvers are templates over a stats policy:
+ * - NoStats: every hook is an empty inline function, so the plain solvers
+ *   compile to the same code as without instrumentation;
+ * - CollectStats: the hooks add to a SolverStats.
+ *
+ * Node, backtrack and check counts depend only on the puzzle and the
+ * algorithm, not on the machine, so they can be compared between runs on
+ * different hardware. The selection time is the only wall-clock counter; it
+ * is sampled (one selection in SELECTION_TIMING_SAMPLE is timed and counted
+ * that many times), so counting does not pay for two clock reads per node,
+ * and it is an estimate best read relatively.
+ *
+ * @author
+ * Keshav Bhandari
+ *
+ * @date
+ * October 16, 2026
+ */
+
+#ifndef SUDOKUPROJECT_SOLVER_STATS_H
+#define SUDOKUPROJECT_SOLVER_STATS_H
+
+#include <chrono>
+#include <cstdint>
+
+/**
+ * @brief Counters of one or more solves.
+ *
+ * The instrumented solvers add to the counters instead of resetting them, so
+ * one struct can aggregate a whole run.
+ */
+struct SolverStats {
+    uint64_t puzzles = 0;          ///< Solves aggregated into these counters
+    uint64_t nodes = 0;            ///< Search nodes visited (cells, or DLX columns, branched on)
+    uint64_t backtracks = 0;       ///< Choices that were tried and undone
+    uint64_t candidateChecks = 0;  ///< Candidate placements tried (the isValid() calls of the original solver)
+    uint64_t propagations = 0;     ///< Constraint propagation passes
+    uint64_t selectionNanos = 0;   ///< Time spent choosing the next cell (findNextCell() in the original solver)
+    int maxDepth = 0;              ///< Deepest chain of nested choices
+
+    /**
+     * @brief Adds the counters of another run; maxDepth keeps the larger value.
+     */
+    SolverStats& operator+=(const SolverStats& other) {
+        puzzles += other.puzzles;
+        nodes += other.nodes;
+        backtracks += other.backtracks;
+        candidateChecks += other.candidateChecks;
+        propagations += other.propagations;
+        selectionNanos += other.selectionNanos;
+        if (other.maxDepth > maxDepth) maxDepth = other.maxDepth;
+        return *this;
+    }
+};
+
+/**
+ * @brief Stats policy that records nothing.
+ */
+struct NoStats {
+    struct Timer {};
+
+    void node(const int&) {}
+    void backtrack() {}
+    void candidateCheck() {}
+    void propagation() {}
+    Timer startSelection() { return {}; }
+    void endSelection(const Timer&) {}
+};
+
+/// One cell selection in this many is timed by CollectStats.
+constexpr uint32_t SELECTION_TIMING_SAMPLE = 64;
+
+/**
+ * @brief Stats policy that adds every event to a SolverStats.
+ */
+struct CollectStats {
+    using Timer = std::chrono::steady_clock::time_point;
+
+    SolverStats& stats;
+    uint32_t selections = 0;
+
+    explicit CollectStats(SolverStats& stats) : stats(stats) {}
+
+    void node(const int& depth) {
+        stats.nodes++;
+        if (depth > stats.maxDepth) stats.maxDepth = depth;
+    }
+    void backtrack() { stats.backtracks++; }
+    void candidateCheck() { stats.candidateChecks++; }
+    void propagation() { stats.propagations++; }
+    // Unsampled selections return the epoch, which endSelection() skips
+    Timer startSelection() {
+        return selections++ % SELECTION_TIMING_SAMPLE == 0 ? std::chrono::steady_clock::now() : Timer();
+    }
+    void endSelection(const Timer& start) {
+        if (start == Timer()) return;
+        stats.selectionNanos += SELECTION_TIMING_SAMPLE * static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+    }
+};
+
+#endif //SUDOKUPROJECT_SOLVER_STATS_H
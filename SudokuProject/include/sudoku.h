@@ -8,8 +8,9 @@
  * - A cell validation function to ensure valid number placement.
  * - A board generation stub for creating Sudoku puzzles.
  *
- * All functions operate on dynamically allocated 9x9 Sudoku boards
- * represented as `int**`, where empty cells are denoted by 0.
+ * Every function operates on the contiguous value-type `Board` (see board.h),
+ * where empty cells are denoted by 0. Overloads taking dynamically allocated
+ * `int**` boards are kept as thin adapters for the legacy API.
  *
  * @author
  * Keshav Bhandari
@@ -21,7 +22,13 @@
 #ifndef SUDOKUPROJECT_SUDOKU_H
 #define SUDOKUPROJECT_SUDOKU_H
 
+#include <cstdint>
+#include <functional>
 #include <iostream>
+#include <tuple>
+#include "board.h"
+#include "solver_stats.h"
+#include "thread_pool.h"
 
 /**
  * @brief Validates if a number can be placed in a specific cell of the Sudoku board.
@@ -39,6 +46,19 @@
  */
 bool isValid(int** BOARD, const int& r, const int& c, const int& k);
 
+/**
+ * @brief Validates if a number can be placed in a specific cell of a `Board`.
+ *
+ * Same rules as the `int**` overload above.
+ *
+ * @param board The Sudoku board.
+ * @param r Row index of the cell to check.
+ * @param c Column index of the cell to check.
+ * @param k Number to validate for placement.
+ * @return true if the number can be placed at the given position, false otherwise.
+ */
+bool isValid(const Board& board, const int& r, const int& c, const int& k);
+
 /**
  * @brief Solves a Sudoku board using backtracking algorithm.
  *
@@ -46,6 +66,35 @@ bool isValid(int** BOARD, const int& r, const int& c, const int& k);
  * in empty cells. The algorithm backtracks when it encounters a dead end.
  * Starts solving from position (r, c) and proceeds row by row.
  *
+ * The candidates of each cell are taken from per-unit used-digit masks
+ * (see solver_engine.h), so trying a digit and undoing it are O(1). A board
+ * whose givens repeat a digit in a unit is rejected immediately.
+ *
+ * @param board The Sudoku board, solved in place.
+ * @param r Starting row index (default: 0).
+ * @param c Starting column index (default: 0).
+ * @return true if the board is solvable, false otherwise.
+ */
+bool solveBoard(Board& board, const int& r=0, const int& c=0);
+
+/**
+ * @brief Instrumented solveBoard(): also adds the search counters of the solve to `stats`.
+ *
+ * Nodes are the empty cells branched on, candidate checks the digits tried
+ * there, and the selection time covers the scan for the next empty cell.
+ *
+ * @param board The Sudoku board, solved in place from the first cell.
+ * @param stats The counters to add to (see solver_stats.h).
+ * @return true if the board is solvable, false otherwise.
+ */
+bool solveBoard(Board& board, SolverStats& stats);
+
+/**
+ * @brief Legacy adapter of solveBoard() for `int**` boards.
+ *
+ * Copies the board into a `Board`, solves it and writes the solution back.
+ * The board is left unchanged when no solution exists.
+ *
  * @param BOARD A pointer to the 2D Sudoku board (int**).
  * @param r Starting row index (default: 0).
  * @param c Starting column index (default: 0).
@@ -56,14 +105,21 @@ bool solveBoard(int** BOARD, const int& r=0, const int& c=0);
 // ========================= Efficient Solutions ==========================
 
 /**
- * @brief Finds the next empty cell in the Sudoku board.
+ * @brief Finds the empty cell with the fewest candidates (MRV).
  *
- * Scans the board from left to right, top to bottom to find the first
- * empty cell (cell with value 0). Returns the coordinates of the empty cell.
+ * Builds the incremental search state of solver_engine.h and returns the
+ * cell with the smallest candidate count, breaking ties by row-major order.
  *
- * @param BOARD A pointer to the 2D Sudoku board (int**).
- * @return std::tuple<int, int, int> A tuple containing (row, column, value) of the empty cell.
- *         If no empty cell is found, returns (-1, -1, -1).
+ * @param board The Sudoku board.
+ * @return std::tuple<int, int, int> A tuple containing (row, column, candidate count) of the chosen cell;
+ *         a count of 0 means that cell has no digit left and the board is a dead end.
+ *         If no empty cell is found, returns (-1, -1, 10).
+ *         If the givens repeat a digit in a row, column or box, returns (-1, -1, 0).
+ */
+std::tuple<int, int, int> findNextCell(const Board& board);
+
+/**
+ * @brief Legacy adapter of findNextCell() for `int**` boards.
  */
 std::tuple<int, int, int> findNextCell(int** BOARD);
 
@@ -71,22 +127,207 @@ std::tuple<int, int, int> findNextCell(int** BOARD);
  * @brief Solves a Sudoku board using an optimized backtracking algorithm.
  *
  * Uses a more efficient approach by:
- * 1. Finding the next empty cell using findNextCell
- * 2. Trying numbers 1-9 in the empty cell
+ * 1. Finding the most constrained empty cell (as findNextCell does)
+ * 2. Trying only the candidates left by the row/column/box masks
  * 3. Recursively solving the rest of the board
  * 4. Backtracking when necessary
  *
+ * Per-cell candidate masks and MRV buckets are updated incrementally when a
+ * digit is placed, and backtracking pops an undo trail instead of rescanning
+ * the board, so choosing a cell costs a few bit scans. Constraint propagation
+ * (naked/hidden singles and locked candidates, see propagate()) runs at the
+ * root and after every guess; a contradiction backtracks immediately.
+ *
+ * @param board The Sudoku board, solved in place.
+ * @return true if the board is solvable, false otherwise.
+ */
+bool solveBoardEfficient(Board& board);
+
+/**
+ * @brief Instrumented solveBoardEfficient(): also adds the search counters of the solve to `stats`.
+ *
+ * Nodes are the MRV cells branched on, propagations count the propagate()
+ * passes, and the selection time covers selectCell().
+ *
+ * @param board The Sudoku board, solved in place.
+ * @param stats The counters to add to (see solver_stats.h).
+ * @return true if the board is solvable, false otherwise.
+ */
+bool solveBoardEfficient(Board& board, SolverStats& stats);
+
+/**
+ * @brief Legacy adapter of solveBoardEfficient() for `int**` boards.
+ *
  * @param BOARD A pointer to the 2D Sudoku board (int**).
  * @return true if the board is solvable, false otherwise.
  */
 bool solveBoardEfficient(int** BOARD);
 
+// ========================= Uniqueness ==========================
+
+/**
+ * @brief Checks whether a Sudoku board has exactly one solution.
+ *
+ * Runs the search of solveBoardEfficient() but keeps going after the first
+ * solution and stops as soon as a second one is found, so a board with many
+ * solutions costs about as much as one with two.
+ *
+ * @param board The Sudoku board (left unchanged).
+ * @return true if the board has exactly one solution, false if it has none or several.
+ */
+bool hasUniqueSolution(const Board& board);
+
+/**
+ * @brief Checks whether a board has a solution in which `cell` does not hold digit `k`.
+ *
+ * This is the uniqueness oracle used by the generator: if a puzzle has the
+ * unique solution S and the clue at `cell` is removed, the new puzzle is still
+ * unique exactly when it has no solution with a digit other than S[cell] there.
+ * Excluding the known digit turns the check into a single solvability search,
+ * which propagation usually settles without any guess.
+ *
+ * @param board The Sudoku board (left unchanged); `cell` must be empty.
+ * @param cell Row-major index of the cell.
+ * @param k The digit excluded from the cell.
+ * @return true if such a solution exists, false otherwise.
+ */
+bool hasSolutionExcluding(const Board& board, const int& cell, const int& k);
+
+// ========================= Solution Counting ==========================
+
+/**
+ * @brief Counts the solutions of a Sudoku board, stopping at `limit`.
+ *
+ * Uses the MRV search with constraint propagation of solveBoardEfficient()
+ * and backtracks after every solution instead of stopping at the first one.
+ * With several threads the top levels of the search tree are split
+ * breadth-first into independent subtrees (about 16 per worker), which are
+ * counted on a work-stealing pool (see thread_pool.h); workers publish their
+ * counts in chunks and all of them stop once the limit is reached.
+ *
+ * @param board The Sudoku board (left unchanged).
+ * @param limit Stop counting at this many solutions; 0 means no limit (default: 0).
+ * @param num_threads Number of worker threads; 0 means one per hardware thread (default: 1).
+ * @return uint64_t The number of solutions, capped at `limit`. Contradictory boards have 0.
+ */
+uint64_t countSolutions(const Board& board, const uint64_t& limit = 0, const int& num_threads = 1);
+
+/**
+ * @brief Legacy adapter of countSolutions() for `int**` boards.
+ */
+uint64_t countSolutions(int** BOARD, const uint64_t& limit = 0, const int& num_threads = 1);
+
+/**
+ * @brief Streams the solutions of a Sudoku board to a callback.
+ *
+ * With a single thread the solutions arrive in search order (MRV cell,
+ * smallest digit first), so the same board always yields the same sequence.
+ * With several threads the search tree is split as in countSolutions(); the
+ * callback is then never called concurrently, but the order is unspecified.
+ *
+ * @param board The Sudoku board (left unchanged).
+ * @param callback Called once per solution with the solved board.
+ * @param limit Stop after this many solutions; 0 means no limit (default: 0).
+ * @param num_threads Number of worker threads; 0 means one per hardware thread (default: 1).
+ * @return uint64_t The number of solutions passed to the callback.
+ */
+uint64_t enumerateSolutions(const Board& board, const std::function<void(const Board&)>& callback,
+                            const uint64_t& limit = 0, const int& num_threads = 1);
+
+/**
+ * @brief Solves one hard puzzle with several threads.
+ *
+ * The first levels of the MRV search tree (more levels with more threads)
+ * are expanded into tasks on a work-stealing pool, each task forking its
+ * children as new tasks; below that depth every subtree is searched by a
+ * ResumableSolver. The subtrees are ordered as the sequential search visits
+ * them, and a subtree that finds a solution publishes its position: subtrees
+ * after it stop at their next check, subtrees before it keep searching.
+ * The result is therefore always the solution solveBoardEfficient() returns,
+ * whatever the thread count or the scheduling.
+ *
+ * Only worth it for puzzles that take milliseconds (very sparse boards, some
+ * 17-clue puzzles); easy puzzles are faster with solveBoardEfficient().
+ *
+ * @param board The Sudoku board, solved in place.
+ * @param num_threads Number of worker threads; 0 means one per hardware thread (default: 0).
+ * @return true if the board is solvable, false otherwise.
+ */
+bool solveBoardParallel(Board& board, const int& num_threads = 0);
+
+/**
+ * @brief Solves one hard puzzle on a caller-owned pool (see solveBoardParallel(Board&, const int&)).
+ *
+ * Reusing one pool saves starting and joining its threads on every call. The
+ * call waits only for its own tasks, so the pool may run other work at the
+ * same time, and several threads may solve on the same pool concurrently.
+ *
+ * @note Must not be called from inside a task of the same pool.
+ *
+ * @param board The Sudoku board, solved in place.
+ * @param pool The pool that runs the search; its size sets the fork depth.
+ * @return true if the board is solvable, false otherwise.
+ */
+bool solveBoardParallel(Board& board, ThreadPool& pool);
+
+// ========================= Solver Selection ==========================
+
+/**
+ * @brief The solver backends available through solve().
+ */
+enum class SolverType {
+    Backtracking,   ///< solveBoard: row-major backtracking
+    Efficient,      ///< solveBoardEfficient: MRV search with constraint propagation
+    DancingLinks    ///< solveBoardDancingLinks: exact cover with Algorithm X (see dlx.h)
+};
+
+/**
+ * @brief Returns the display name of a solver backend (e.g. "solveBoard").
+ */
+const char* getSolverName(const SolverType& solver);
+
+/**
+ * @brief Solves a Sudoku board with the selected solver backend.
+ *
+ * @param board The Sudoku board, solved in place.
+ * @param solver The backend to use.
+ * @return true if the board is solvable, false otherwise.
+ */
+bool solve(Board& board, const SolverType& solver);
+
+/**
+ * @brief Solves a Sudoku board with the selected backend and adds its search counters to `stats`.
+ *
+ * The plain solve() overloads are compiled without any instrumentation;
+ * use this one when the counters are needed.
+ *
+ * @param board The Sudoku board, solved in place.
+ * @param solver The backend to use.
+ * @param stats The counters to add to (see solver_stats.h).
+ * @return true if the board is solvable, false otherwise.
+ */
+bool solve(Board& board, const SolverType& solver, SolverStats& stats);
+
+/**
+ * @brief Legacy adapter of solve(Board&, const SolverType&) for `int**` boards.
+ */
+bool solve(int** board, const SolverType& solver);
+
 /**
  * @brief Solves a Sudoku board using either the standard or efficient solver.
  *
  * Provides a unified interface to solve Sudoku boards using either the
  * standard backtracking algorithm or the optimized version.
  *
+ * @param board The Sudoku board, solved in place.
+ * @param efficient Flag to choose between standard (false) and efficient (true) solver.
+ * @return true if the board is solvable, false otherwise.
+ */
+bool solve(Board& board, const bool& efficient = false);
+
+/**
+ * @brief Legacy adapter of solve() for `int**` boards.
+ *
  * @param board A pointer to the 2D Sudoku board (int**).
  * @param efficient Flag to choose between standard (false) and efficient (true) solver.
  * @return true if the board is solvable, false otherwise.
@@ -6,12 +6,13 @@
  * and managing Sudoku puzzles. It includes utilities to:
  * - Print Sudoku boards to the console with color-coded hints.
  * - Read and write Sudoku puzzles from/to files.
- * - Parse and extract numbers from text representations.
+ * - Parse and validate text representations of boards without allocating.
  * - Generate and solve multiple Sudoku puzzles.
  * - Handle file system operations to read puzzle sets from directories.
  *
- * The functions work with a dynamically allocated 9x9 Sudoku board
- * represented as `int**`, where empty cells are denoted by 0.
+ * The functions work with the contiguous value-type `Board` (see board.h),
+ * where empty cells are denoted by 0. Overloads taking dynamically allocated
+ * `int**` boards are kept as thin adapters for the legacy API.
  *
  * @author
  * Keshav Bhandari
@@ -25,6 +26,9 @@
 
 #include <vector>
 #include <string>
+#include "board.h"
+#include "solver_stats.h"
+#include "sudoku.h"
 using namespace std;
 
 /**
@@ -36,23 +40,34 @@ using namespace std;
  * - Red if placing `k` violates Sudoku rules.
  * - Yellow for empty cells.
  *
- * @param BOARD A pointer to the 2D Sudoku board (int**).
+ * @param BOARD The Sudoku board.
  * @param r Row index for the candidate (default: 0).
  * @param c Column index for the candidate (default: 0).
  * @param k Candidate number to test (default: 0, no candidate highlighted).
  * @param color to print the board item in color to highlight different status (invalid entry, valid entry and so on..) (default: false, do not use terminal coloring).
  */
+void printBoard(const Board& BOARD, const int& r=0, const int& c=0, int k=0, const bool& color=false);
+
+/**
+ * @brief Legacy adapter of printBoard() for `int**` boards.
+ */
 void printBoard(int** BOARD, const int& r=0, const int& c=0, int k=0, const bool& color=false);
 
 /**
  * @brief Converts the Sudoku board into a string representation.
  *
  * Converts the 9x9 board into a string format, using '-' for empty cells.
- * Includes separators for readability.
+ * Includes separators for readability. The text is produced by formatBoard()
+ * (see board_format.h) and appended to `content`.
  *
- * @param BOARD A pointer to the 2D Sudoku board (int**).
+ * @param BOARD The Sudoku board.
  * @param content Reference to a string where the board will be stored.
  */
+void boardToString(const Board& BOARD, string& content);
+
+/**
+ * @brief Legacy adapter of boardToString() for `int**` boards.
+ */
 void boardToString(int** BOARD, string& content);
 
 /**
@@ -60,11 +75,17 @@ void boardToString(int** BOARD, string& content);
  *
  * Serializes the board into a formatted string and writes it to the specified file.
  *
- * @param BOARD A pointer to the 2D Sudoku board (int**).
+ * @param BOARD The Sudoku board.
  * @param filename Name of the file to write the board to.
+ * @param verbose Print a confirmation line to the console (default: true).
  * @return true if writing was successful, false otherwise.
  */
-bool writeSudokuToFile(int** BOARD, const string& filename);
+bool writeSudokuToFile(const Board& BOARD, const string& filename, const bool& verbose = true);
+
+/**
+ * @brief Legacy adapter of writeSudokuToFile() for `int**` boards.
+ */
+bool writeSudokuToFile(int** BOARD, const string& filename, const bool& verbose = true);
 
 /**
  * @brief Replaces all occurrences of a character in a string.
@@ -91,22 +112,92 @@ void extractNumbers(const string& input, vector<int>& numbers);
 /**
  * @brief Fills a Sudoku board with numbers from a vector.
  *
- * Populates a 9x9 Sudoku board using numbers from a vector. Assumes the
- * vector has at least 81 integers.
+ * Populates a 9x9 Sudoku board using numbers from a vector. Cells without a
+ * matching number (when the vector holds fewer than 81) are left empty.
  *
  * @param numbers A vector containing the numbers to fill the board.
- * @param BOARD A pointer to the 2D Sudoku board (int**) to fill.
+ * @param BOARD The board to fill.
+ */
+void fillBoard(const vector<int>& numbers, Board& BOARD);
+
+/**
+ * @brief Legacy variant of fillBoard() that allocates the rows of an `int**` board.
+ *
+ * @param numbers A vector containing the numbers to fill the board.
+ * @param BOARD An array of 9 row pointers; each row is allocated by this function.
  */
 void fillBoard(const vector<int>& numbers, int** BOARD);
 
+/**
+ * @brief Kinds of malformed input reported by parseBoard().
+ */
+enum class ParseError {
+    None,                 ///< The text holds a valid puzzle
+    InvalidCharacter,     ///< A character that is neither a cell nor a separator
+    TooFewCells,          ///< The text ends before 81 cells were read
+    TooManyCells,         ///< Cells follow the 81st cell
+    ContradictoryGivens,  ///< A digit repeats in a row, column or box
+    FileError             ///< The file could not be opened or is too large
+};
+
+/**
+ * @brief Outcome of parseBoard(), with the 1-based position of the offending character.
+ */
+struct ParseStatus {
+    ParseError error = ParseError::None;
+    int line = 0;     ///< Line of the error (0 when it has no position)
+    int column = 0;   ///< Column of the error (0 when it has no position)
+
+    bool ok() const { return error == ParseError::None; }
+};
+
+/**
+ * @brief Returns a short description of a parse error (e.g. "invalid character").
+ */
+const char* getParseErrorMessage(const ParseError& error);
+
+/**
+ * @brief Parses a Sudoku board from text in a single pass, without allocating.
+ *
+ * Accepts the pretty format written by writeSudokuToFile() as well as the
+ * compact formats: one line of 81 cells, nine lines of nine cells, or cells
+ * separated by spaces or commas.
+ * - `1`-`9` are givens; `0`, `.` and `-` are blanks.
+ * - Spaces, tabs, `|`, `,` and `+` only separate cells.
+ * - A line made only of `-`, `.`, `+` and spaces is a separator line and is
+ *   skipped if it holds a `+` (e.g. `+---+---+---+`) or is not 9 or 81
+ *   cells long (e.g. the 21 dots of the pretty format). A line with a `0`,
+ *   a `|` or a `,` always holds cells, so a puzzle wrapped over lines of any
+ *   length reads correctly.
+ *
+ * Reading stops with an error at the first invalid character, when the text
+ * holds fewer or more than 81 cells, or when the givens repeat a digit in a
+ * unit; the returned status then points at the offending character.
+ *
+ * @param text The text to parse.
+ * @param length Number of characters in `text`.
+ * @param BOARD The board that receives the puzzle (unspecified on error).
+ * @return ParseStatus The result, with the position of the error if any.
+ */
+ParseStatus parseBoard(const char* text, const size_t& length, Board& BOARD);
+
 /**
  * @brief Reads a Sudoku board from a file.
  *
- * Parses a file containing a Sudoku puzzle, converts the content into a
- * 9x9 board, and returns a dynamically allocated board.
+ * Reads the file into a fixed stack buffer and parses it with parseBoard().
+ * Malformed files are reported on `cerr` with the position of the error.
+ *
+ * @param filename The path to the file containing the Sudoku puzzle.
+ * @param BOARD The board that receives the puzzle.
+ * @return true if the file could be read and holds a valid puzzle, false otherwise.
+ */
+bool readSudokuFromFile(const string& filename, Board& BOARD);
+
+/**
+ * @brief Legacy adapter of readSudokuFromFile() returning an `int**` board.
  *
  * @param filename The path to the file containing the Sudoku puzzle.
- * @return A pointer to a dynamically allocated 2D Sudoku board.
+ * @return A pointer to a dynamically allocated 2D Sudoku board, or nullptr if the file could not be read.
  */
 int** readSudokuFromFile(const string& filename);
 
@@ -117,16 +208,23 @@ int** readSudokuFromFile(const string& filename);
  * - Each row contains unique numbers from 1 to 9.
  * - Each column contains unique numbers from 1 to 9.
  * - Each 3x3 subgrid contains unique numbers from 1 to 9.
+ * - No cell is left empty.
  *
- * @param BOARD A pointer to the 2D Sudoku board (int**).
+ * @param BOARD The Sudoku board.
  * @return true if the solution is valid, false otherwise.
  */
+bool checkIfSolutionIsValid(const Board& BOARD);
+
+/**
+ * @brief Legacy adapter of checkIfSolutionIsValid() for `int**` boards.
+ */
 bool checkIfSolutionIsValid(int** BOARD);
 
 /**
  * @brief Retrieves all Sudoku puzzle filenames in a given folder.
  *
- * Scans the specified folder and returns paths to all Sudoku puzzle files.
+ * Scans the specified folder and returns paths to all Sudoku puzzle files,
+ * sorted by name so that the i-th puzzle is the same on every run.
  *
  * @param folderPath Path to the folder containing Sudoku puzzles.
  * @return A vector of file paths to the Sudoku puzzles.
@@ -139,11 +237,23 @@ vector<string> getAllSudokuInFolder(const string& folderPath);
  * Generates `num_puzzles` new Sudoku boards and saves them as text files
  * in the specified destination folder with filenames prefixed by `prefix`.
  *
+ * Generation is sharded across a work-stealing thread pool. Puzzle i is
+ * generated from its own random engine seeded with `(seed, i)`, so the same
+ * seed produces the same files whatever the number of threads.
+ *
+ * With `unique` set, puzzles come from generateUniqueBoard(), so every file has
+ * exactly one solution; a puzzle may then have fewer empty cells than requested.
+ *
  * @param num_puzzles The number of puzzles to generate.
+ * @param complexity_empty_boxes The number of empty cells of each puzzle.
  * @param destination Folder where the puzzles will be saved.
  * @param prefix Filename prefix for the saved puzzles.
+ * @param num_threads Number of worker threads; 0 means one per hardware thread (default: 1).
+ * @param seed Seed of the whole corpus; 0 picks a random seed and prints it (default: 0).
+ * @param unique Generate only puzzles with a unique solution (default: false).
+ * @param verbose Print a line per written file when running on one thread (default: false, summary only).
  */
-void createAndSaveNPuzzles(const int& num_puzzles, const int& complexity_empty_boxes, const string& destination, const string& prefix);
+void createAndSaveNPuzzles(const int& num_puzzles, const int& complexity_empty_boxes, const string& destination, const string& prefix, const int& num_threads = 1, const uint64_t& seed = 0, const bool& unique = false, const bool& verbose = false);
 
 /**
  * @brief Solves and saves multiple Sudoku puzzles from a source folder.
@@ -151,30 +261,55 @@ void createAndSaveNPuzzles(const int& num_puzzles, const int& complexity_empty_b
  * Reads unsolved puzzles from `source`, solves them, and saves the
  * solutions to `destination` with filenames prefixed by `prefix`.
  *
+ * With more than one thread, the puzzles are read, solved, validated and
+ * written by a work-stealing thread pool (see thread_pool.h). The i-th puzzle
+ * is always saved as the i-th solution, and only a summary is printed. The
+ * sequential mode also prints only the summary unless `verbose` is set.
+ * With `collect_stats`, both modes end with the search counters aggregated over all puzzles.
+ *
  * @param num_puzzles The number of puzzles to solve.
  * @param source Folder containing unsolved puzzles.
  * @param destination Folder where solved puzzles will be saved.
  * @param prefix Filename prefix for the saved solutions.
+ * @param num_threads Number of worker threads; 0 means one per hardware thread (default: 1, sequential).
+ * @param verbose Print progress for every puzzle in sequential mode (default: false).
+ * @param solver The solver backend (default: SolverType::Backtracking).
+ * @param collect_stats Solve through the instrumented overloads and print the search counters;
+ *        off by default because counting slows the search down (default: false).
  */
-void solveAndSaveNPuzzles(const int& num_puzzles, const string& source, const string& destination, const string& prefix);
+void solveAndSaveNPuzzles(const int& num_puzzles, const string& source, const string& destination, const string& prefix, const int& num_threads = 1, const bool& verbose = false, const SolverType& solver = SolverType::Backtracking, const bool& collect_stats = false);
 
 /**
  * @brief Performs a deep copy of a 9x9 Sudoku board.
  *
+ * Only needed for legacy `int**` boards; a `Board` is copied by assignment.
+ *
  * @param original The original 9x9 Sudoku board to copy.
  * @return int** A pointer to the newly allocated deep-copied board.
  */
 int** deepCopyBoard(int** original);
 
 /**
- * @brief Compares the performance of solveBoard and efficientSolveBoard.
+ * @brief Prints the per-puzzle averages of aggregated search counters.
+ *
+ * @param name The solver name shown at the start of the line.
+ * @param stats The aggregated counters (see solver_stats.h).
+ */
+void printSolverStats(const string& name, const SolverStats& stats);
+
+/**
+ * @brief Compares the performance of solveBoard, efficientSolveBoard and the Dancing Links solver.
  *
- * Runs both solvers multiple times on generated Sudoku boards and prints
- * the average runtime for each solver.
+ * Runs every solver backend on the same generated Sudoku boards and prints
+ * the average runtime and the number of valid solutions for each solver.
+ * With `collect_stats`, each solver's average search counters follow; they
+ * come from a second, instrumented solve of every board, so they do not
+ * affect the timings but double the running time.
  *
  * @param experiment_size Number of experiments to run.
  * @param empty_boxes Number of empty cells in the generated Sudoku board.
+ * @param collect_stats Also solve every board instrumented and print the search counters (default: false).
  */
-void compareSudokuSolvers(const int& experiment_size, const int& empty_boxes);
+void compareSudokuSolvers(const int& experiment_size, const int& empty_boxes, const bool& collect_stats = false);
 
 #endif //SUDOKUPROJECT_SUDOKUIO_H
\ No newline at end of file
@@ -0,0 +1,136 @@
+/**
+ * @file thread_pool.h
+ * @brief Work-stealing thread pool used by the batch and parallel solvers.
+ *
+ * Every worker owns a deque of tasks. A worker pops its own newest task first
+ * (LIFO, cache friendly) and, when its deque is empty, steals the oldest task
+ * of another worker (FIFO), so a few long tasks never leave the other cores idle.
+ * Tasks submitted from inside a worker go to that worker's deque, which lets
+ * tasks fork subtasks.
+ *
+ * @author
+ * Keshav Bhandari
+ *
+ * @date
+ * October 16, 2026
+ */
+
+#ifndef SUDOKUPROJECT_THREAD_POOL_H
+#define SUDOKUPROJECT_THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Returns the number of workers to use for a requested thread count.
+ *
+ * @param requested The requested number of threads; 0 or less means one per hardware thread.
+ * @return int A worker count of at least 1.
+ */
+int resolveThreadCount(const int& requested);
+
+/**
+ * @brief A fixed-size pool of worker threads with per-worker deques and work stealing.
+ */
+class ThreadPool {
+public:
+    /**
+     * @brief Starts the workers.
+     *
+     * @param workers Number of worker threads; 0 means one per hardware thread.
+     */
+    explicit ThreadPool(const int& workers = 0);
+
+    /**
+     * @brief Waits for all submitted tasks, then stops and joins the workers.
+     */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * @brief Returns the number of worker threads.
+     */
+    int size() const { return static_cast<int>(workers.size()); }
+
+    /**
+     * @brief Queues a task.
+     *
+     * From a worker thread the task goes to that worker's own deque; from any
+     * other thread the deques are filled round-robin.
+     *
+     * @param task The task to run.
+     */
+    void submit(std::function<void()> task);
+
+    /**
+     * @brief Queues a task on the deque of a specific worker.
+     *
+     * @param task The task to run.
+     * @param worker Index of the worker whose deque receives the task.
+     */
+    void submitTo(std::function<void()> task, const int& worker);
+
+    /**
+     * @brief Blocks until every submitted task (including forked subtasks) has finished.
+     *
+     * A task that throws does not stop its worker or the other tasks; the
+     * first exception thrown since the previous wait() is rethrown here, once
+     * every task has finished.
+     *
+     * @note Must not be called from inside a task of the same pool.
+     */
+    void wait();
+
+    /**
+     * @brief Returns the index of the calling worker in its pool, or -1 outside any worker.
+     */
+    static int currentWorker();
+
+private:
+    struct WorkerQueue {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    std::vector<std::unique_ptr<WorkerQueue>> queues;
+    std::vector<std::thread> workers;
+
+    std::mutex stateMutex;
+    std::condition_variable taskAvailable;
+    std::condition_variable allDone;
+    std::atomic<int> queued{0};      // Tasks sitting in a deque
+    std::atomic<int> unfinished{0};  // Tasks submitted but not yet completed
+    std::atomic<unsigned> nextQueue{0};
+    bool stopping = false;
+    std::exception_ptr firstError;   // First exception thrown by a task since the last wait (stateMutex)
+
+    void workerLoop(const int& index);
+    std::exception_ptr waitIdle();
+    bool popTask(const int& index, std::function<void()>& task);
+};
+
+/**
+ * @brief Runs `body(i)` for every i in [0, count) on a temporary work-stealing pool.
+ *
+ * Indices are dealt out as contiguous blocks, one per worker, and idle workers
+ * steal from the others. With a single worker the loop runs on the calling thread.
+ * If `body` throws, the iterations already dealt out still run and the first
+ * exception is rethrown once they are done; on the calling thread it leaves
+ * the loop at once.
+ *
+ * @param count Number of iterations.
+ * @param threads Number of workers; 0 means one per hardware thread.
+ * @param body The loop body, called concurrently from several threads.
+ */
+void parallelFor(const int& count, const int& threads, const std::function<void(int)>& body);
+
+#endif //SUDOKUPROJECT_THREAD_POOL_H
@@ -1,77 +1,496 @@
+#include "include/board_format.h"
+#include "include/corpus.h"
 #include "include/generator.h"
+#include "include/grid_solver.h"
+#include "include/line_stream.h"
+#include "include/pipeline.h"
+#include "include/rater.h"
+#include "include/solution_cache.h"
+#include "include/solver_service.h"
 #include "include/sudoku.h"
 #include "include/sudoku_io.h"
+#include "include/thread_pool.h"
 #include "include/utils.h"
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
 #include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
 
 using namespace std;
 
-// Define DEBUG_MODE to enable debug main, comment following to run the actual program
-#define DEBUG_MODE
-
+// Defaults of the command line options
+string PATH_TO_DATA = "data/";
 string PATH_TO_PUZZLES = "data/puzzles/";
 string PATH_TO_SOLUTIONS = "data/solutions/";
 
-string PUZZLE_PREFIX = "PUZZLE";
 string SOLUTION_PREFIX = "SOLUTION";
 
 int NUM_PUZZLE_TO_GENERATE = 10;
 
 int COMPLEXITY_EMPTY_BOXES = 45;
 
-#ifdef DEBUG_MODE
+int NUM_THREADS = 0; // 0 = one worker per hardware thread
+
+/**
+ * @brief Options shared by all subcommands; each subcommand reads the ones it needs.
+ */
+struct CommandLine {
+    string command;
+    map<string, string> values;   // --name value
+    map<string, bool> flags;      // --name
+
+    bool has(const string& name) const { return values.count(name) > 0; }
+    string get(const string& name, const string& fallback) const {
+        const auto it = values.find(name);
+        return it == values.end() ? fallback : it->second;
+    }
+    long long getNumber(const string& name, const long long& fallback) const {
+        const auto it = values.find(name);
+        return it == values.end() ? fallback : atoll(it->second.c_str());
+    }
+};
+
+/**
+ * @brief Prints the usage of the program to stderr.
+ */
+void printUsage() {
+    cerr << "Usage: SudokuProject <command> [options]\n"
+            "\n"
+            "Commands:\n"
+            "  generate   Generate puzzles\n"
+            "  solve      Solve puzzles from a folder, a one-line stream or a corpus\n"
+            "  pipeline   Generate, solve, verify and write puzzles as concurrent stages\n"
+            "  bench      Compare the solver backends on generated puzzles (see also sudoku_bench)\n"
+            "  serve      Answer solve and validate requests on a Unix socket, or on stdin/stdout\n"
+            "\n"
+            "Options:\n"
+            "  --threads N      Worker threads, 0 = one per hardware thread (default: 0)\n"
+            "  --count N        Number of puzzles, or of experiments for bench (default: 10)\n"
+            "  --seed S         Seed of the generated puzzles, 0 = random (default: 0)\n"
+            "  --format F       files, line or corpus (default: files)\n"
+            "  --output PATH    Output folder (files), file or - for stdout (line), or file (corpus)\n"
+            "  --input PATH     solve: puzzle folder (files), file or - for stdin (line), or corpus file\n"
+            "  --empty K        Empty cells per puzzle (default: 45)\n"
+            "  --difficulty D   easy, medium, hard, expert or extreme (replaces --empty)\n"
+            "  --no-unique      Allow puzzles with several solutions\n"
+            "  --stats          solve --format files, bench: collect and print the search counters (slower)\n"
+            "  --solver S       backtracking, efficient or dlx (default: efficient; solve --format line\n"
+            "                   always uses the batch solver)\n"
+            "  --queue N        pipeline: capacity of the queues between stages (default: 1024);\n"
+            "                   serve: requests waiting for a batch (default: 4096)\n"
+            "  --size N         Grid size: 4, 9, 16 or 25 (default: 9); other sizes than 9 only support\n"
+            "                   --format line, with digits 1-9 then A-P\n"
+            "  --socket PATH    serve: Unix socket to listen on (default: stdin/stdout)\n"
+            "  --batch N        serve: most requests per micro-batch (default: 64)\n"
+            "  --delay US       serve: how long a partial batch waits for more requests (default: 20)\n"
+            "  --budget US      serve: search time allowed per solve request (default: 0 = no limit)\n"
+            "  --cache N        solve --format corpus, serve: answer repeated puzzles and their isomorphs\n"
+            "                   from a cache of N solutions (default: 0 = no cache)\n";
+}
+
 /**
- * @brief Debug main function for testing and experimenting.
+ * @brief Splits argv into a subcommand and its options.
  *
- * This function is designed to help developers quickly test and experiment
- * with different functions across the program without running the full production flow.
+ * @return true if every option is known and has its value, false otherwise.
+ */
+bool parseCommandLine(int argc, char** argv, CommandLine& cli) {
+    static const vector<string> VALUE_OPTIONS = {"threads", "count", "seed", "format", "output", "input",
+                                                 "empty", "difficulty", "solver", "queue", "size",
+                                                 "socket", "batch", "delay", "budget", "cache"};
+    if (argc < 2) return false;
+    cli.command = argv[1];
+
+    for (int i = 2; i < argc; i++) {
+        const string arg = argv[i];
+        if (arg.rfind("--", 0) != 0) {
+            cerr << "Unexpected argument: " << arg << endl;
+            return false;
+        }
+        const string name = arg.substr(2);
+        if (name == "no-unique" || name == "stats") {
+            cli.flags[name] = true;
+            continue;
+        }
+        bool known = false;
+        for (const string& option : VALUE_OPTIONS) known = known || option == name;
+        if (!known || i + 1 >= argc) {
+            cerr << (known ? "Missing value for: " : "Unknown option: ") << arg << endl;
+            return false;
+        }
+        cli.values[name] = argv[++i];
+    }
+    return true;
+}
+
+/**
+ * @brief Reads --solver.
+ */
+bool parseSolver(const CommandLine& cli, SolverType& solver) {
+    const string name = cli.get("solver", "efficient");
+    if (name == "backtracking") solver = SolverType::Backtracking;
+    else if (name == "efficient") solver = SolverType::Efficient;
+    else if (name == "dlx") solver = SolverType::DancingLinks;
+    else {
+        cerr << "Unknown solver: " << name << endl;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Reads the pipeline settings shared by `generate` and `pipeline`.
+ */
+bool parsePipelineOptions(const CommandLine& cli, PipelineOptions& options) {
+    options.count = static_cast<int>(cli.getNumber("count", NUM_PUZZLE_TO_GENERATE));
+    options.emptyBoxes = static_cast<int>(cli.getNumber("empty", COMPLEXITY_EMPTY_BOXES));
+    options.unique = !cli.flags.count("no-unique");
+    options.seed = static_cast<uint64_t>(strtoull(cli.get("seed", "0").c_str(), nullptr, 10));
+    options.threads = static_cast<int>(cli.getNumber("threads", NUM_THREADS));
+    options.queueCapacity = static_cast<int>(cli.getNumber("queue", options.queueCapacity));
+    options.output = cli.get("output", PATH_TO_DATA);
+
+    if (options.count < 0 || options.emptyBoxes < 0 || options.emptyBoxes > 81) {
+        cerr << "Invalid --count or --empty" << endl;
+        return false;
+    }
+    if (!parsePipelineFormat(cli.get("format", "files"), options.format)) {
+        cerr << "Unknown format: " << cli.get("format", "") << endl;
+        return false;
+    }
+    if (options.format != PipelineFormat::Files && !cli.has("output")) {
+        cerr << "--output is required with --format " << cli.get("format", "") << " (use - for stdout)" << endl;
+        return false;
+    }
+    if (options.format == PipelineFormat::Corpus && options.output == "-") {
+        cerr << "A corpus cannot be written to stdout" << endl;
+        return false;
+    }
+    if (cli.has("difficulty")) {
+        const string name = cli.get("difficulty", "");
+        bool found = false;
+        for (int d = 0; d <= static_cast<int>(Difficulty::Extreme); d++) {
+            if (name == getDifficultyName(static_cast<Difficulty>(d))) {
+                options.useDifficulty = true;
+                options.difficulty = static_cast<Difficulty>(d);
+                found = true;
+            }
+        }
+        if (!found) {
+            cerr << "Unknown difficulty: " << name << endl;
+            return false;
+        }
+    }
+    return parseSolver(cli, options.solver);
+}
+
+/**
+ * @brief `generate` and `pipeline`: runs the staged pipeline, with or without the solve stages.
+ *
+ * @return int The process exit code.
+ */
+int runPipelineCommand(const CommandLine& cli, const bool& solve) {
+    PipelineOptions options;
+    if (!parsePipelineOptions(cli, options)) return 1;
+    options.solve = solve;
+
+    PipelineStats stats;
+    const bool ok = runPipeline(options, stats);
+
+    // The summary goes to stderr, so `--output -` can be piped
+    cerr << stats.written << "/" << options.count << " puzzles written with seed " << stats.seed;
+    if (solve) cerr << ", " << stats.verified << " verified solutions";
+    if (stats.offBand) cerr << ", " << stats.offBand << " outside the difficulty band";
+    cerr << " in " << stats.seconds << " s" << endl;
+    return ok ? 0 : 1;
+}
+
+/**
+ * @brief `solve --format corpus`: solves every puzzle of a corpus and writes a corpus with solutions.
  *
- * Use this space to:
- * - Test specific functions (e.g., board generation, solving, printing).
- * - Experiment with new features or changes.
- * - Verify function integration from different headers.
- * - Run isolated tests to debug specific issues.
+ * @return int The process exit code.
  */
-int main() {
-    // You can modify this main function to access all other function implemented
-    //
-    cout << "Running in DEBUG MODE...\n";
-
-    // Example: Generate a single puzzle and print it
-    int** board = generateBoard(COMPLEXITY_EMPTY_BOXES);  // Generate with 40 empty cells
-    cout << "Generated Sudoku Puzzle:\n";
-    printBoard(board);  // Assuming printBoard is defined in sudoku_io.h
-
-    // Test solving the puzzle
-    if (solve(board)) {
-        cout << "Solved Puzzle:\n";
-        printBoard(board);
+int solveCorpus(const CommandLine& cli, const SolverType& solver) {
+    if (!cli.has("input") || !cli.has("output")) {
+        cerr << "--input and --output are required with --format corpus" << endl;
+        return 1;
+    }
+    CorpusReader reader;
+    if (!reader.open(cli.get("input", ""))) return 1;
+
+    const int count = static_cast<int>(reader.size());
+    const long long cacheCapacity = cli.getNumber("cache", 0);
+    unique_ptr<SolutionCache> cache(cacheCapacity > 0 ? new SolutionCache(static_cast<size_t>(cacheCapacity)) : nullptr);
+    vector<Board> puzzles(count), solutions(count);
+    vector<char> solved(count, 0);
+    parallelFor(count, static_cast<int>(cli.getNumber("threads", NUM_THREADS)), [&](int i) {
+        reader.puzzle(static_cast<uint64_t>(i), puzzles[i]);
+        solutions[i] = puzzles[i];
+        solved[i] = (cache ? solve(solutions[i], solver, *cache) : solve(solutions[i], solver)) ? 1 : 0;
+        if (!solved[i]) solutions[i] = Board{};
+    });
+
+    int total = 0;
+    for (const char& s : solved) total += s;
+    cerr << total << "/" << count << " puzzles solved";
+    if (cache) cerr << ", " << cache->hits() << " cache hits, " << cache->misses() << " misses";
+    cerr << endl;
+    return writeCorpus(cli.get("output", ""), puzzles, &solutions) ? 0 : 1;
+}
+
+/**
+ * @brief `solve`: solves puzzle files, a one-line stream or a corpus.
+ *
+ * @return int The process exit code.
+ */
+int runSolveCommand(const CommandLine& cli) {
+    SolverType solver;
+    if (!parseSolver(cli, solver)) return 1;
+    const string format = cli.get("format", "files");
+    if (cli.has("cache") && format != "corpus") {
+        cerr << "--cache is only supported with --format corpus" << endl;
+        return 1;
+    }
+
+    if (format == "files") {
+        const string source = cli.get("input", PATH_TO_PUZZLES);
+        string destination = cli.get("output", PATH_TO_SOLUTIONS);
+        if (!destination.empty() && destination.back() != '/') destination += '/';
+        error_code error;
+        if (!filesystem::is_directory(source, error)) {
+            cerr << "Puzzle folder not found: " << source << endl;
+            return 1;
+        }
+        createFolder(destination);
+
+        // --count only changes the "over total" figures of the summary
+        int available = 0;
+        for (const auto& entry : filesystem::directory_iterator(source)) {
+            if (entry.is_regular_file()) available++;
+        }
+        solveAndSaveNPuzzles(static_cast<int>(cli.getNumber("count", available)), source, destination,
+                             SOLUTION_PREFIX, static_cast<int>(cli.getNumber("threads", NUM_THREADS)), false, solver,
+                             cli.flags.count("stats") > 0);
+        return 0;
+    }
+
+    if (format == "line") {
+        // The stream solver always uses the batch solver
+        const string input = cli.get("input", "-");
+        const string output = cli.get("output", "-");
+        FILE* in = (input == "-") ? stdin : fopen(input.c_str(), "rb");
+        if (!in) {
+            cerr << "Unable to open file: " << input << endl;
+            return 1;
+        }
+        FILE* out = (output == "-") ? stdout : fopen(output.c_str(), "wb");
+        if (!out) {
+            cerr << "Unable to open file: " << output << endl;
+            if (in != stdin) fclose(in);
+            return 1;
+        }
+        const LineStreamStats stats = solveLineStream(in, out);
+        if (in != stdin) fclose(in);
+        if (out != stdout) fclose(out);
+
+        cerr << stats.solved << "/" << stats.puzzles << " puzzles solved, " << stats.unsolvable << " unsolvable, "
+             << stats.malformed << " malformed lines" << endl;
+        return 0;
+    }
+
+    if (format == "corpus") return solveCorpus(cli, solver);
+
+    cerr << "Unknown format: " << format << endl;
+    return 1;
+}
+
+/**
+ * @brief `generate`, `pipeline` and `solve` on 4x4, 16x16 and 25x25 grids, in the one-line format.
+ *
+ * Puzzle `i` is generated from Rng stream `(seed, i)`, as in the pipeline.
+ * `pipeline` writes `puzzle,solution` lines; `solve` writes the solution of
+ * every puzzle line, or the puzzle itself when it has no solution.
+ *
+ * @return int The process exit code.
+ */
+template <int BOX>
+int runGridCommand(const CommandLine& cli) {
+    constexpr int CELLS = GridTraits<BOX>::CELLS;
+    if (cli.get("format", "line") != "line") {
+        cerr << "--size " << GridTraits<BOX>::SIZE << " only supports --format line" << endl;
+        return 1;
+    }
+    const int threads = static_cast<int>(cli.getNumber("threads", NUM_THREADS));
+    const string output = cli.get("output", "-");
+    vector<Grid<BOX>> puzzles, solutions;
+    vector<char> solved;
+
+    if (cli.command == "solve") {
+        const string input = cli.get("input", "-");
+        ifstream file;
+        if (input != "-") {
+            file.open(input);
+            if (!file) {
+                cerr << "Unable to open file: " << input << endl;
+                return 1;
+            }
+        }
+        istream& in = (input == "-") ? cin : file;
+        int malformed = 0;
+        for (string line; getline(in, line);) {
+            if (line.empty() || line == "\r") continue;
+            Grid<BOX> puzzle;
+            if (parseGridLine<BOX>(line.data(), line.size(), puzzle)) puzzles.push_back(puzzle);
+            else malformed++;
+        }
+        if (malformed) cerr << malformed << " malformed lines skipped" << endl;
     } else {
-        cout << "Failed to solve the puzzle.\n";
+        const int count = static_cast<int>(cli.getNumber("count", NUM_PUZZLE_TO_GENERATE));
+        const int empty = static_cast<int>(cli.getNumber("empty", COMPLEXITY_EMPTY_BOXES * CELLS / 81));
+        if (count < 0 || empty < 0 || empty > CELLS) {
+            cerr << "Invalid --count or --empty" << endl;
+            return 1;
+        }
+        uint64_t seed = static_cast<uint64_t>(strtoull(cli.get("seed", "0").c_str(), nullptr, 10));
+        if (!seed) seed = threadRng().next();
+        const bool unique = !cli.flags.count("no-unique");
+        puzzles.resize(count);
+        parallelFor(count, threads, [&](int i) {
+            Rng rng(seed, static_cast<uint64_t>(i));
+            generateGrid<BOX>(puzzles[i], empty, rng, unique);
+        });
+        cerr << count << " puzzles generated with seed " << seed << endl;
+    }
+
+    const bool solving = cli.command != "generate";
+    if (solving) {
+        solutions = puzzles;
+        solved.assign(puzzles.size(), 0);
+        parallelFor(static_cast<int>(puzzles.size()), threads, [&](int i) {
+            solved[i] = solveGrid<BOX>(solutions[i]) && checkGridSolution<BOX>(solutions[i]) ? 1 : 0;
+        });
     }
 
-    // Clean up memory
-    deallocateBoard(board);
+    FILE* out = (output == "-") ? stdout : fopen(output.c_str(), "wb");
+    if (!out) {
+        cerr << "Unable to open file: " << output << endl;
+        return 1;
+    }
+    int total = 0;
+    {
+        BoardWriter writer(out, BoardFormat::Line);
+        vector<char> line(2 * CELLS + 1);
+        for (size_t i = 0; i < puzzles.size(); i++) {
+            size_t length = 0;
+            if (cli.command != "solve") length = static_cast<size_t>(formatGridLine<BOX>(puzzles[i], line.data()));
+            if (solving) {
+                total += solved[i];
+                if (length) line[length++] = ',';
+                const Grid<BOX>& result = solved[i] ? solutions[i] : puzzles[i];
+                length += static_cast<size_t>(formatGridLine<BOX>(result, line.data() + length));
+            }
+            writer.addLine(line.data(), length);
+        }
+    }
+    if (out != stdout) fclose(out);
+    if (solving) cerr << total << "/" << puzzles.size() << " puzzles solved" << endl;
+    return 0;
+}
 
+/**
+ * @brief `bench`: compares the solver backends on freshly generated puzzles.
+ *
+ * Without --count and --empty, runs the experiment sizes of the original production program.
+ *
+ * @return int The process exit code.
+ */
+int runBenchCommand(const CommandLine& cli) {
+    const bool stats = cli.flags.count("stats") > 0;
+    if (cli.has("count") || cli.has("empty")) {
+        compareSudokuSolvers(static_cast<int>(cli.getNumber("count", 100)),
+                             static_cast<int>(cli.getNumber("empty", COMPLEXITY_EMPTY_BOXES)), stats);
+        return 0;
+    }
+    compareSudokuSolvers(10, 64, stats);
+    compareSudokuSolvers(100, 45, stats);
+    compareSudokuSolvers(1000, 32, stats);
+    compareSudokuSolvers(10000, 16, stats);
     return 0;
 }
-#else
+
+/**
+ * @brief `serve`: runs the solver service (see solver_service.h) until end of input or SIGINT/SIGTERM.
+ *
+ * @return int The process exit code.
+ */
+int runServeCommand(const CommandLine& cli) {
+    ServiceOptions options;
+    options.socketPath = cli.get("socket", "");
+    options.threads = static_cast<int>(cli.getNumber("threads", NUM_THREADS));
+    options.maxBatch = static_cast<int>(cli.getNumber("batch", options.maxBatch));
+    options.maxDelayMicros = static_cast<int>(cli.getNumber("delay", options.maxDelayMicros));
+    options.queueCapacity = static_cast<int>(cli.getNumber("queue", options.queueCapacity));
+    options.solveBudgetMicros = static_cast<int>(cli.getNumber("budget", options.solveBudgetMicros));
+    options.cacheCapacity = static_cast<int>(cli.getNumber("cache", options.cacheCapacity));
+    if (options.maxBatch < 1 || options.maxDelayMicros < 0 || options.solveBudgetMicros < 0 || options.cacheCapacity < 0) {
+        cerr << "Invalid --batch, --delay, --budget or --cache" << endl;
+        return 1;
+    }
+
+    ServiceStats stats;
+    const bool ok = runSolverService(options, stats);
+    if (stats.requests) {
+        cerr << stats.requests << " requests in " << stats.batches << " batches over " << stats.connections
+             << " connections, mean latency " << stats.totalMicros / static_cast<double>(stats.requests)
+             << " us, max " << stats.maxMicros << " us";
+        if (options.cacheCapacity > 0) cerr << ", " << stats.cacheHits << " cache hits, " << stats.cacheMisses << " misses";
+        cerr << endl;
+    }
+    return ok ? 0 : 1;
+}
+
 /**
- * @brief Main function for production use.
+ * @brief Main function: dispatches to the subcommands.
  *
- * Generates, solves, and compares Sudoku puzzles.
+ * Examples:
+ * - `SudokuProject pipeline --count 1000 --threads 8` writes puzzles and
+ *   solutions to data/puzzles/ and data/solutions/;
+ * - `SudokuProject generate --count 100000 --difficulty hard --format corpus --output hard.sdkc`;
+ * - `SudokuProject solve --format line < puzzles.txt > solutions.txt`;
+ * - `SudokuProject generate --size 16 --count 100 --format line --output 16x16.txt`;
+ * - `SudokuProject serve --socket /tmp/sudoku.sock`.
  */
-int main() {
-    initDataFolder();
-    createAndSaveNPuzzles(NUM_PUZZLE_TO_GENERATE, COMPLEXITY_EMPTY_BOXES, PATH_TO_PUZZLES, PUZZLE_PREFIX);
-    solveAndSaveNPuzzles(NUM_PUZZLE_TO_GENERATE, PATH_TO_PUZZLES, PATH_TO_SOLUTIONS, SOLUTION_PREFIX);
+int main(int argc, char** argv) {
+    CommandLine cli;
+    if (!parseCommandLine(argc, argv, cli)) {
+        printUsage();
+        return 1;
+    }
 
-    // Run experiments to compare solvers
-    compareSudokuSolvers(10, 64);
-    compareSudokuSolvers(100, 45);
-    compareSudokuSolvers(1000, 32);
-    compareSudokuSolvers(10000, 16);
+    const bool gridCommand = cli.command == "generate" || cli.command == "pipeline" || cli.command == "solve";
+    if (gridCommand && cli.has("size")) {
+        const string size = cli.get("size", "9");
+        if (size == "4") return runGridCommand<2>(cli);
+        if (size == "16") return runGridCommand<4>(cli);
+        if (size == "25") return runGridCommand<5>(cli);
+        if (size != "9") {
+            cerr << "Unsupported grid size: " << size << endl;
+            return 1;
+        }
+    }
 
-    return 0;
+    if (cli.command == "generate") return runPipelineCommand(cli, false);
+    if (cli.command == "pipeline") return runPipelineCommand(cli, true);
+    if (cli.command == "solve") return runSolveCommand(cli);
+    if (cli.command == "bench") return runBenchCommand(cli);
+    if (cli.command == "serve") return runServeCommand(cli);
+
+    const bool help = cli.command == "help" || cli.command == "--help" || cli.command == "-h";
+    if (!help) cerr << "Unknown command: " << cli.command << endl;
+    printUsage();
+    return help ? 0 : 1;
 }
-#endif
@@ -0,0 +1,228 @@
+/**
+ * @file batch_solver.cpp
+ * @brief Implementation of the SIMD multi-board batch solver.
+ *
+ * Detailed function descriptions are provided in the corresponding header file.
+ *
+ * @author
+ * Keshav Bhandari
+ *
+ * @date
+ * October 16, 2026
+ */
+
+#include "../include/batch_solver.h"
+#include "../include/solver_engine.h"
+#include "../include/sudoku.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace {
+
+// ========================= Lane Operations ==========================
+// A `Lanes` value holds one 16-bit candidate mask for each of the 16 boards.
+
+#if defined(__AVX2__)
+
+struct Lanes { __m256i v; };
+
+inline Lanes load(const uint16_t* p) { return {_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p))}; }
+inline void store(uint16_t* p, const Lanes& a) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), a.v); }
+inline Lanes broadcast(const uint16_t& x) { return {_mm256_set1_epi16(static_cast<short>(x))}; }
+inline Lanes operator&(const Lanes& a, const Lanes& b) { return {_mm256_and_si256(a.v, b.v)}; }
+inline Lanes operator|(const Lanes& a, const Lanes& b) { return {_mm256_or_si256(a.v, b.v)}; }
+inline Lanes operator^(const Lanes& a, const Lanes& b) { return {_mm256_xor_si256(a.v, b.v)}; }
+inline Lanes andNot(const Lanes& a, const Lanes& b) { return {_mm256_andnot_si256(b.v, a.v)}; }
+inline Lanes minusOne(const Lanes& a) { return {_mm256_sub_epi16(a.v, _mm256_set1_epi16(1))}; }
+inline Lanes isZero(const Lanes& a) { return {_mm256_cmpeq_epi16(a.v, _mm256_setzero_si256())}; }
+inline bool any(const Lanes& a) { return !_mm256_testz_si256(a.v, a.v); }
+
+const char* KERNEL_NAME = "avx2";
+
+#elif defined(__SSE2__)
+
+struct Lanes { __m128i lo, hi; };
+
+inline Lanes load(const uint16_t* p) {
+    return {_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)), _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 8))};
+}
+inline void store(uint16_t* p, const Lanes& a) {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(p), a.lo);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(p + 8), a.hi);
+}
+inline Lanes broadcast(const uint16_t& x) { return {_mm_set1_epi16(static_cast<short>(x)), _mm_set1_epi16(static_cast<short>(x))}; }
+inline Lanes operator&(const Lanes& a, const Lanes& b) { return {_mm_and_si128(a.lo, b.lo), _mm_and_si128(a.hi, b.hi)}; }
+inline Lanes operator|(const Lanes& a, const Lanes& b) { return {_mm_or_si128(a.lo, b.lo), _mm_or_si128(a.hi, b.hi)}; }
+inline Lanes operator^(const Lanes& a, const Lanes& b) { return {_mm_xor_si128(a.lo, b.lo), _mm_xor_si128(a.hi, b.hi)}; }
+inline Lanes andNot(const Lanes& a, const Lanes& b) { return {_mm_andnot_si128(b.lo, a.lo), _mm_andnot_si128(b.hi, a.hi)}; }
+inline Lanes minusOne(const Lanes& a) {
+    const __m128i one = _mm_set1_epi16(1);
+    return {_mm_sub_epi16(a.lo, one), _mm_sub_epi16(a.hi, one)};
+}
+inline Lanes isZero(const Lanes& a) {
+    const __m128i zero = _mm_setzero_si128();
+    return {_mm_cmpeq_epi16(a.lo, zero), _mm_cmpeq_epi16(a.hi, zero)};
+}
+inline bool any(const Lanes& a) { return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_or_si128(a.lo, a.hi), _mm_setzero_si128())) != 0xFFFF; }
+
+const char* KERNEL_NAME = "sse2";
+
+#else
+
+struct Lanes { uint16_t v[BATCH_LANES]; };
+
+inline Lanes load(const uint16_t* p) { Lanes a; for (int i = 0; i < BATCH_LANES; i++) a.v[i] = p[i]; return a; }
+inline void store(uint16_t* p, const Lanes& a) { for (int i = 0; i < BATCH_LANES; i++) p[i] = a.v[i]; }
+inline Lanes broadcast(const uint16_t& x) { Lanes a; for (auto& lane : a.v) lane = x; return a; }
+inline Lanes operator&(const Lanes& a, const Lanes& b) { Lanes r; for (int i = 0; i < BATCH_LANES; i++) r.v[i] = a.v[i] & b.v[i]; return r; }
+inline Lanes operator|(const Lanes& a, const Lanes& b) { Lanes r; for (int i = 0; i < BATCH_LANES; i++) r.v[i] = a.v[i] | b.v[i]; return r; }
+inline Lanes operator^(const Lanes& a, const Lanes& b) { Lanes r; for (int i = 0; i < BATCH_LANES; i++) r.v[i] = a.v[i] ^ b.v[i]; return r; }
+inline Lanes andNot(const Lanes& a, const Lanes& b) { Lanes r; for (int i = 0; i < BATCH_LANES; i++) r.v[i] = a.v[i] & ~b.v[i]; return r; }
+inline Lanes minusOne(const Lanes& a) { Lanes r; for (int i = 0; i < BATCH_LANES; i++) r.v[i] = static_cast<uint16_t>(a.v[i] - 1); return r; }
+inline Lanes isZero(const Lanes& a) { Lanes r; for (int i = 0; i < BATCH_LANES; i++) r.v[i] = a.v[i] ? 0 : 0xFFFF; return r; }
+inline bool any(const Lanes& a) { uint16_t x = 0; for (auto lane : a.v) x |= lane; return x != 0; }
+
+const char* KERNEL_NAME = "scalar";
+
+#endif
+
+// Keeps the lanes whose mask has exactly one bit set, zero elsewhere
+inline Lanes singles(const Lanes& a) {
+    return a & isZero(a & minusOne(a));
+}
+
+/**
+ * Propagates naked and hidden singles in all lanes until no lane changes.
+ * Masks only ever shrink, so the loop terminates. Lanes with a contradiction
+ * get a non-zero entry in `dead`.
+ */
+void propagateLanes(uint16_t (*candidates)[BATCH_LANES], uint16_t* dead) {
+    const EngineTables& tables = engineTables();
+    const Lanes all = broadcast(ALL_DIGITS);
+    Lanes contradiction = broadcast(0);
+
+    // Singles whose digit was already removed from the peers; masks never grow back, so they are skipped
+    uint16_t propagated[81][BATCH_LANES] = {};
+
+    for (;;) {
+        Lanes changed = broadcast(0);
+
+        // Naked singles: a decided cell removes its digit from all its peers
+        for (int cell = 0; cell < 81; cell++) {
+            const Lanes decided = singles(load(candidates[cell]));
+            const Lanes single = andNot(decided, load(propagated[cell]));
+            if (!any(single)) continue;
+            store(propagated[cell], decided);
+            for (int i = 0; i < 20; i++) {
+                uint16_t* peer = candidates[tables.peers[cell][i]];
+                const Lanes before = load(peer);
+                const Lanes after = andNot(before, single);
+                changed = changed | (before ^ after);
+                store(peer, after);
+            }
+        }
+
+        // Hidden singles: a digit with a single place in a unit goes there
+        for (int u = 0; u < 27; u++) {
+            const uint8_t* unit = tables.units[u];
+            Lanes once = broadcast(0), twice = broadcast(0);
+            for (int j = 0; j < 9; j++) {
+                const Lanes options = load(candidates[unit[j]]);
+                twice = twice | (once & options);
+                once = once | options;
+            }
+            contradiction = contradiction | andNot(all, isZero(once ^ all));
+
+            const Lanes exactlyOnce = andNot(once, twice);
+            if (!any(exactlyOnce)) continue;
+            for (int j = 0; j < 9; j++) {
+                uint16_t* cell = candidates[unit[j]];
+                const Lanes before = load(cell);
+                const Lanes hidden = before & exactlyOnce;
+                const Lanes keep = isZero(hidden);
+                const Lanes after = (before & keep) | andNot(hidden, keep);
+                changed = changed | (before ^ after);
+                store(cell, after);
+            }
+        }
+
+        if (!any(changed)) break;
+    }
+
+    for (int cell = 0; cell < 81; cell++) {
+        contradiction = contradiction | isZero(load(candidates[cell]));
+    }
+    store(dead, contradiction);
+}
+
+} // namespace
+
+const char* getBatchKernelName() {
+    return KERNEL_NAME;
+}
+
+int solveBoardsBatch(Board* boards, const int& count, bool* solved, SolverStats* stats) {
+    int totalSolved = 0;
+    uint16_t candidates[81][BATCH_LANES];
+    uint16_t dead[BATCH_LANES];
+
+    for (int first = 0; first < count; first += BATCH_LANES) {
+        const int lanes = (count - first < BATCH_LANES) ? count - first : BATCH_LANES;
+
+        // Givens become single-candidate cells; unused lanes stay all-open and never change
+        bool invalid[BATCH_LANES] = {};
+        for (int cell = 0; cell < 81; cell++) {
+            for (int lane = 0; lane < BATCH_LANES; lane++) {
+                uint16_t mask = ALL_DIGITS;
+                if (lane < lanes) {
+                    const int k = boards[first + lane][cell];
+                    if (k > 9) invalid[lane] = true;
+                    else if (k != 0) mask = digitBit(k);
+                }
+                candidates[cell][lane] = mask;
+            }
+        }
+
+        propagateLanes(candidates, dead);
+
+        for (int lane = 0; lane < lanes; lane++) {
+            Board& board = boards[first + lane];
+            bool success = false;
+            if (stats) {
+                stats->puzzles++;
+                stats->propagations++;  // The shared vector pass
+            }
+
+            if (!dead[lane] && !invalid[lane]) {
+                Board deduced = board;
+                bool complete = true;
+                for (int cell = 0; cell < 81; cell++) {
+                    const uint16_t options = candidates[cell][lane];
+                    if (countDigits(options) == 1) deduced[cell] = static_cast<uint8_t>(lowestDigit(options));
+                    else complete = false;
+                }
+
+                // Propagation already proved every single, so only the rest needs a search
+                if (complete) {
+                    success = true;
+                } else if (stats) {
+                    SolverStats search;
+                    success = solveBoardEfficient(deduced, search);
+                    search.puzzles = 0;  // Already counted above
+                    *stats += search;
+                } else {
+                    success = solveBoardEfficient(deduced);
+                }
+                if (success) board = deduced;
+            }
+
+            if (solved) solved[first + lane] = success;
+            if (success) totalSolved++;
+        }
+    }
+    return totalSolved;
+}
@@ -0,0 +1,41 @@
+/**
+ * @file board.cpp
+ * @brief Conversions between `Board` and the legacy `int**` boards.
+ *
+ * Detailed function descriptions are provided in the corresponding header file.
+ *
+ * @author
+ * Keshav Bhandari
+ *
+ * @date
+ * October 16, 2026
+ */
+
+#include "../include/board.h"
+
+Board boardFromLegacy(int** BOARD) {
+    Board board;
+    for (int r = 0; r < 9; r++) {
+        for (int c = 0; c < 9; c++) {
+            board.at(r, c) = static_cast<uint8_t>(BOARD[r][c]);
+        }
+    }
+    return board;
+}
+
+void copyBoardToLegacy(const Board& board, int** BOARD) {
+    for (int r = 0; r < 9; r++) {
+        for (int c = 0; c < 9; c++) {
+            BOARD[r][c] = board.at(r, c);
+        }
+    }
+}
+
+int** boardToLegacy(const Board& board) {
+    int** BOARD = new int*[9];
+    for (int r = 0; r < 9; r++) {
+        BOARD[r] = new int[9];
+    }
+    copyBoardToLegacy(board, BOARD);
+    return BOARD;
+}
@@ -0,0 +1,127 @@
+/**
+ * @file board_format.cpp
+ * @brief Implementation of the fixed-size board formatters and the buffered writer.
+ *
+ * Detailed function descriptions are provided in the corresponding header file.
+ *
+ * @author
+ * Keshav Bhandari
+ *
+ * @date
+ * October 16, 2026
+ */
+
+#include "../include/board_format.h"
+#include <cstring>
+#include <iostream>
+
+using namespace std;
+
+namespace {
+
+// The pretty layout of an empty board and the position of every cell in it
+struct PrettyLayout {
+    char text[PRETTY_BOARD_SIZE];
+    uint8_t offsets[81];
+
+    PrettyLayout() {
+        int pos = 0;
+        for (int i = 0; i < 9; i++) {
+            for (int j = 0; j < 9; j++) {
+                offsets[i * 9 + j] = static_cast<uint8_t>(pos);
+                text[pos++] = '-';
+                if (j == 2 || j == 5) {
+                    text[pos++] = ' ';
+                    text[pos++] = '|';
+                }
+                text[pos++] = ' ';
+            }
+            if (i == 2 || i == 5) {
+                text[pos++] = '\n';
+                for (int l = 0; l < 21; l++) text[pos++] = '.';
+            }
+            text[pos++] = '\n';
+        }
+    }
+};
+
+const PrettyLayout& prettyLayout() {
+    static const PrettyLayout layout;
+    return layout;
+}
+
+} // namespace
+
+int formatBoard(const Board& board, char* out) {
+    const PrettyLayout& layout = prettyLayout();
+    memcpy(out, layout.text, PRETTY_BOARD_SIZE);
+    for (int i = 0; i < 81; i++) {
+        if (board[i] != 0) out[layout.offsets[i]] = static_cast<char>('0' + board[i]);
+    }
+    return PRETTY_BOARD_SIZE;
+}
+
+int formatBoardLine(const Board& board, char* out) {
+    for (int i = 0; i < 81; i++) {
+        out[i] = board[i] ? static_cast<char>('0' + board[i]) : '.';
+    }
+    return LINE_BOARD_SIZE;
+}
+
+// ========================= BoardWriter ==========================
+
+BoardWriter::BoardWriter(FILE* out, const BoardFormat& format, const size_t& buffer_size)
+    : out(out), format(format), threshold(buffer_size) {
+    buffer.reserve(buffer_size + PRETTY_BOARD_SIZE + 1);
+}
+
+BoardWriter::~BoardWriter() {
+    flush();
+}
+
+void BoardWriter::add(const Board& board) {
+    const size_t offset = buffer.size();
+    if (format == BoardFormat::Line) {
+        buffer.resize(offset + LINE_BOARD_SIZE + 1);
+        formatBoardLine(board, buffer.data() + offset);
+        buffer.back() = '\n';
+    } else {
+        // Boards after the first are separated by an empty line
+        const size_t gap = count ? 1 : 0;
+        buffer.resize(offset + gap + PRETTY_BOARD_SIZE);
+        if (gap) buffer[offset] = '\n';
+        formatBoard(board, buffer.data() + offset + gap);
+    }
+    count++;
+    if (buffer.size() >= threshold) flush();
+}
+
+void BoardWriter::addLine(const char* text, const size_t& length) {
+    buffer.insert(buffer.end(), text, text + length);
+    buffer.push_back('\n');
+    if (buffer.size() >= threshold) flush();
+}
+
+bool BoardWriter::flush() {
+    if (!buffer.empty() && fwrite(buffer.data(), 1, buffer.size(), out) != buffer.size()) {
+        failed = true;
+    }
+    buffer.clear();
+    return !failed;
+}
+
+bool writeBoardsToFile(const vector<Board>& boards, const string& filename, const BoardFormat& format) {
+    FILE* file = fopen(filename.c_str(), "wb");
+    if (!file) {
+        cerr << "Unable to open file: " << filename << endl;
+        return false;
+    }
+
+    bool ok;
+    {
+        BoardWriter writer(file, format);
+        for (const Board& board : boards) writer.add(board);
+        ok = writer.flush();
+    }
+    return fclose(file) == 0 && ok;
+}
@@ -0,0 +1,243 @@
+/**
+ * @file canonical.cpp
+ * @brief Implementation of the grid symmetries and the canonical form search.
+ *
+ * Detailed function descriptions are provided in the corresponding header file.
+ *
+ * @author
+ * Keshav Bhandari
+ *
+ * @date
+ * October 16, 2026
+ */
+
+#include "../include/canonical.h"
+#include <algorithm>
+#include <cstring>
+
+using namespace std;
+
+namespace {
+
+/**
+ * Branch-and-bound search for the smallest isomorph.
+ *
+ * The output is built in reading order: first the source line of row 0 (one
+ * of the 9 rows of the board or of its transpose), then the columns of row 0
+ * one cell at a time, which fixes the whole column order, then rows 1 to 8
+ * one row at a time. At every step only the choices giving the smallest next
+ * cell (or row) are kept, and a branch is cut as soon as it is larger than
+ * the best form found so far. Digits are relabeled in order of first
+ * appearance, which is always the smallest relabeling of a given layout.
+ */
+class Canonicalizer {
+public:
+    explicit Canonicalizer(const Board& board) {
+        for (int r = 0; r < 9; r++) {
+            for (int c = 0; c < 9; c++) {
+                grids[0][r * 9 + c] = board[r * 9 + c];
+                grids[1][r * 9 + c] = board[c * 9 + r];
+            }
+        }
+    }
+
+    Board run(BoardTransform* transform) {
+        // Lines with the most blanks make the smallest first rows, so they give a tight bound early
+        int lines[18], blanks[18];
+        for (int line = 0; line < 18; line++) {
+            lines[line] = line;
+            blanks[line] = 0;
+            for (int c = 0; c < 9; c++) blanks[line] += grids[line / 9][(line % 9) * 9 + c] == 0;
+        }
+        stable_sort(lines, lines + 18, [&blanks](const int& a, const int& b) { return blanks[a] > blanks[b]; });
+
+        for (const int& line : lines) {
+            current.transpose = line >= 9;
+            current.rows[0] = static_cast<uint8_t>(line % 9);
+            source = grids[line / 9];
+            memset(labels, 0, sizeof(labels));
+            nextLabel = 1;
+            chooseColumn(0, true, 0);
+        }
+        if (transform) *transform = bestTransform;
+        return best;
+    }
+
+private:
+    uint8_t grids[2][81];     // The board and its transpose
+    const uint8_t* source = nullptr;
+    Board out;
+    Board best;
+    bool haveBest = false;
+    BoardTransform current;
+    BoardTransform bestTransform;
+    uint8_t labels[10];       // New label of every source digit, 0 while it has not appeared
+    int nextLabel = 1;
+
+    // Chooses the source column of output column j; returns true if a new best form was found below
+    bool chooseColumn(const int& j, bool equal, const int& usedColumns) {
+        if (j == 9) return chooseRow(1, equal, 1 << current.rows[0]);
+
+        int candidates[9], values[9];
+        int count = 0, minimum = 10;
+        const int first = j % 3 == 0 ? 0 : (current.cols[j - 1] / 3) * 3;
+        const int last = j % 3 == 0 ? 9 : first + 3;
+        for (int c = first; c < last; c++) {
+            if (usedColumns & (1 << c)) continue;
+            // A new stack may only start on a stack no column was taken from
+            if (j % 3 == 0 && (usedColumns >> ((c / 3) * 3)) & 7) continue;
+            const int digit = source[current.rows[0] * 9 + c];
+            const int value = digit ? (labels[digit] ? labels[digit] : nextLabel) : 0;
+            candidates[count] = c;
+            values[count++] = value;
+            minimum = min(minimum, value);
+        }
+
+        if (haveBest && equal) {
+            if (minimum > best[j]) return false;
+            if (minimum < best[j]) equal = false;
+        }
+
+        bool improved = false;
+        for (int i = 0; i < count; i++) {
+            if (values[i] != minimum) continue;
+            const int c = candidates[i];
+            const int digit = source[current.rows[0] * 9 + c];
+            const bool fresh = digit && !labels[digit];
+            if (fresh) labels[digit] = static_cast<uint8_t>(nextLabel++);
+            current.cols[j] = static_cast<uint8_t>(c);
+            out[j] = static_cast<uint8_t>(minimum);
+
+            // Once a better form is recorded, the path to it is the new bound
+            if (chooseColumn(j + 1, equal, usedColumns | (1 << c))) improved = equal = true;
+
+            if (fresh) {
+                labels[digit] = 0;
+                nextLabel--;
+            }
+        }
+        return improved;
+    }
+
+    // Chooses the source row of output row i; returns true if a new best form was found below
+    bool chooseRow(const int& i, bool equal, const int& usedRows) {
+        if (i == 9) return record(equal);
+
+        int candidates[6], count = 0;
+        uint8_t values[6][9];
+        uint8_t candidateLabels[6][10];
+        int candidateNext[6];
+        int smallest = -1;
+
+        const int first = i % 3 == 0 ? 0 : (current.rows[i - 1] / 3) * 3;
+        const int last = i % 3 == 0 ? 9 : first + 3;
+        for (int r = first; r < last; r++) {
+            if (usedRows & (1 << r)) continue;
+            if (i % 3 == 0 && (usedRows >> ((r / 3) * 3)) & 7) continue;
+
+            memcpy(candidateLabels[count], labels, sizeof(labels));
+            int next = nextLabel;
+            for (int c = 0; c < 9; c++) {
+                const int digit = source[r * 9 + current.cols[c]];
+                if (digit && !candidateLabels[count][digit]) candidateLabels[count][digit] = static_cast<uint8_t>(next++);
+                values[count][c] = candidateLabels[count][digit];
+            }
+            candidateNext[count] = next;
+            candidates[count] = r;
+            if (smallest < 0 || memcmp(values[count], values[smallest], 9) < 0) smallest = count;
+            count++;
+        }
+
+        if (haveBest && equal) {
+            const int order = memcmp(values[smallest], &best[i * 9], 9);
+            if (order > 0) return false;
+            if (order < 0) equal = false;
+        }
+
+        bool improved = false;
+        uint8_t saved[10];
+        memcpy(saved, labels, sizeof(labels));
+        const int savedNext = nextLabel;
+        for (int k = 0; k < count; k++) {
+            if (memcmp(values[k], values[smallest], 9) != 0) continue;
+            memcpy(labels, candidateLabels[k], sizeof(labels));
+            nextLabel = candidateNext[k];
+            current.rows[i] = static_cast<uint8_t>(candidates[k]);
+            memcpy(&out[i * 9], values[k], 9);
+
+            if (chooseRow(i + 1, equal, usedRows | (1 << candidates[k]))) improved = equal = true;
+
+            memcpy(labels, saved, sizeof(labels));
+            nextLabel = savedNext;
+        }
+        return improved;
+    }
+
+    bool record(const bool& equal) {
+        if (haveBest && equal) return false;   // The same form through another transform
+        best = out;
+        haveBest = true;
+        bestTransform = current;
+        // Digits missing from the board take the remaining labels in order
+        int next = nextLabel;
+        bestTransform.digits[0] = 0;
+        for (int digit = 1; digit <= 9; digit++) {
+            bestTransform.digits[digit] = static_cast<uint8_t>(labels[digit] ? labels[digit] : next++);
+        }
+        return true;
+    }
+};
+
+} // namespace
+
+Board applyTransform(const Board& board, const BoardTransform& transform) {
+    Board result;
+    for (int r = 0; r < 9; r++) {
+        for (int c = 0; c < 9; c++) {
+            const int source = transform.transpose ? transform.cols[c] * 9 + transform.rows[r]
+                                                   : transform.rows[r] * 9 + transform.cols[c];
+            result[r * 9 + c] = transform.digits[board[source]];
+        }
+    }
+    return result;
+}
+
+Board invertTransform(const Board& board, const BoardTransform& transform) {
+    uint8_t inverse[10];
+    for (int digit = 0; digit <= 9; digit++) inverse[transform.digits[digit]] = static_cast<uint8_t>(digit);
+
+    Board result;
+    for (int r = 0; r < 9; r++) {
+        for (int c = 0; c < 9; c++) {
+            const int source = transform.transpose ? transform.cols[c] * 9 + transform.rows[r]
+                                                   : transform.rows[r] * 9 + transform.cols[c];
+            result[source] = inverse[board[r * 9 + c]];
+        }
+    }
+    return result;
+}
+
+BoardTransform randomTransform(Rng& rng) {
+    BoardTransform transform;
+    rng.shuffle(transform.digits + 1, 9);
+
+    int bands[3] = {0, 1, 2}, stacks[3] = {0, 1, 2};
+    rng.shuffle(bands, 3);
+    rng.shuffle(stacks, 3);
+    for (int b = 0; b < 3; b++) {
+        int inner_rows[3] = {0, 1, 2}, inner_cols[3] = {0, 1, 2};
+        rng.shuffle(inner_rows, 3);
+        rng.shuffle(inner_cols, 3);
+        for (int i = 0; i < 3; i++) {
+            transform.rows[b * 3 + i] = static_cast<uint8_t>(bands[b] * 3 + inner_rows[i]);
+            transform.cols[b * 3 + i] = static_cast<uint8_t>(stacks[b] * 3 + inner_cols[i]);
+        }
+    }
+    transform.transpose = rng.nextBelow(2) == 1;
+    return transform;
+}
+
+Board canonicalForm(const Board& board, BoardTransform* transform) {
+    Canonicalizer canonicalizer(board);
+    return canonicalizer.run(transform);
+}
@@ -0,0 +1,248 @@
+/**
+ * @file corpus.cpp
+ * @brief Implementation of the packed binary corpus writer and memory-mapped reader.
+ *
+ * Detailed function descriptions are provided in the corresponding header file.
+ *
+ * @author
+ * Keshav Bhandari
+ *
+ * @date
+ * October 16, 2026
+ */
+
+#include "../include/corpus.h"
+#include <cstring>
+#include <iostream>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+static const char CORPUS_MAGIC[4] = {'S', 'D', 'K', 'C'};
+static const uint16_t CORPUS_VERSION = 1;
+static const size_t WRITE_BUFFER_SIZE = 1 << 20;
+
+// Little-endian helpers, so corpora are portable between machines
+static void storeLE(uint8_t* out, uint64_t value, const int& bytes) {
+    for (int i = 0; i < bytes; i++, value >>= 8) out[i] = static_cast<uint8_t>(value);
+}
+
+static uint64_t loadLE(const uint8_t* in, const int& bytes) {
+    uint64_t value = 0;
+    for (int i = bytes - 1; i >= 0; i--) value = (value << 8) | in[i];
+    return value;
+}
+
+static uint32_t recordSizeFor(const uint16_t& flags) {
+    uint32_t size = PACKED_BOARD_SIZE;
+    if (flags & CORPUS_HAS_SOLUTIONS) size += PACKED_BOARD_SIZE;
+    if (flags & CORPUS_HAS_METADATA) size += 8;
+    return size;
+}
+
+void packBoard(const Board& board, uint8_t* out) {
+    for (int i = 0; i < 40; i++) {
+        out[i] = static_cast<uint8_t>(board[2 * i] | (board[2 * i + 1] << 4));
+    }
+    out[40] = board[80];
+}
+
+void unpackBoard(const uint8_t* in, Board& board) {
+    for (int i = 0; i < 40; i++) {
+        board[2 * i] = in[i] & 0x0F;
+        board[2 * i + 1] = in[i] >> 4;
+    }
+    board[80] = in[40] & 0x0F;
+}
+
+// ========================= CorpusWriter ==========================
+
+CorpusWriter::~CorpusWriter() {
+    if (file.is_open()) close();
+}
+
+bool CorpusWriter::open(const string& filename, const uint16_t& flags) {
+    if (file.is_open()) close();
+
+    file.open(filename, ios::binary | ios::trunc);
+    if (!file.is_open()) {
+        cerr << "Unable to open file: " << filename << endl;
+        return false;
+    }
+    this->flags = flags;
+    recordSize = recordSizeFor(flags);
+    count = 0;
+    buffer.clear();
+    buffer.reserve(WRITE_BUFFER_SIZE + recordSize);
+
+    // Placeholder header; the record count is filled in by close()
+    buffer.resize(CORPUS_HEADER_SIZE, 0);
+    return true;
+}
+
+bool CorpusWriter::flushBuffer() {
+    file.write(reinterpret_cast<const char*>(buffer.data()), static_cast<streamsize>(buffer.size()));
+    buffer.clear();
+    return static_cast<bool>(file);
+}
+
+bool CorpusWriter::add(const Board& puzzle, const Board* solution, const CorpusMetadata* metadata) {
+    if (!file.is_open()) return false;
+
+    const size_t offset = buffer.size();
+    buffer.resize(offset + recordSize, 0);
+    uint8_t* out = buffer.data() + offset;
+
+    packBoard(puzzle, out);
+    out += PACKED_BOARD_SIZE;
+    if (flags & CORPUS_HAS_SOLUTIONS) {
+        if (solution) packBoard(*solution, out);
+        out += PACKED_BOARD_SIZE;
+    }
+    if ((flags & CORPUS_HAS_METADATA) && metadata) {
+        storeLE(out, metadata->id, 4);
+        storeLE(out + 4, metadata->score, 2);
+        out[6] = metadata->difficulty;
+        out[7] = metadata->technique;
+    }
+    count++;
+
+    return buffer.size() < WRITE_BUFFER_SIZE || flushBuffer();
+}
+
+bool CorpusWriter::close() {
+    if (!file.is_open()) return false;
+
+    bool ok = flushBuffer();
+
+    uint8_t header[CORPUS_HEADER_SIZE] = {};
+    memcpy(header, CORPUS_MAGIC, 4);
+    storeLE(header + 4, CORPUS_VERSION, 2);
+    storeLE(header + 6, flags, 2);
+    storeLE(header + 8, recordSize, 4);
+    storeLE(header + 16, count, 8);
+    file.seekp(0);
+    file.write(reinterpret_cast<const char*>(header), CORPUS_HEADER_SIZE);
+    ok = ok && static_cast<bool>(file);
+
+    file.close();
+    return ok;
+}
+
+bool writeCorpus(const string& filename, const vector<Board>& puzzles, const vector<Board>* solutions) {
+    if (solutions && solutions->size() != puzzles.size()) {
+        cerr << "Puzzle and solution counts differ for corpus: " << filename << endl;
+        return false;
+    }
+
+    CorpusWriter writer;
+    if (!writer.open(filename, solutions ? CORPUS_HAS_SOLUTIONS : 0)) return false;
+    for (size_t i = 0; i < puzzles.size(); i++) {
+        writer.add(puzzles[i], solutions ? &(*solutions)[i] : nullptr);
+    }
+    return writer.close();
+}
+
+// ========================= CorpusReader ==========================
+
+CorpusReader::~CorpusReader() {
+    close();
+}
+
+void CorpusReader::close() {
+#if !defined(_WIN32)
+    if (data && fallback.empty()) {
+        munmap(const_cast<uint8_t*>(data), length);
+    }
+#endif
+    fallback.clear();
+    fallback.shrink_to_fit();
+    data = records = nullptr;
+    length = 0;
+    flags = 0;
+    recordSize = 0;
+    count = 0;
+}
+
+bool CorpusReader::open(const string& filename) {
+    close();
+
+#if defined(_WIN32)
+    ifstream file(filename, ios::binary | ios::ate);
+    if (!file.is_open()) {
+        cerr << "Unable to open file: " << filename << endl;
+        return false;
+    }
+    fallback.resize(static_cast<size_t>(file.tellg()));
+    file.seekg(0);
+    file.read(reinterpret_cast<char*>(fallback.data()), static_cast<streamsize>(fallback.size()));
+    data = fallback.data();
+    length = fallback.size();
+#else
+    const int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        cerr << "Unable to open file: " << filename << endl;
+        return false;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size < CORPUS_HEADER_SIZE) {
+        ::close(fd);
+        cerr << "Invalid corpus file: " << filename << endl;
+        return false;
+    }
+    length = static_cast<size_t>(info.st_size);
+    void* mapping = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);  // The mapping keeps the file alive
+    if (mapping == MAP_FAILED) {
+        length = 0;
+        cerr << "Unable to map file: " << filename << endl;
+        return false;
+    }
+    data = static_cast<const uint8_t*>(mapping);
+#endif
+
+    if (length < static_cast<size_t>(CORPUS_HEADER_SIZE) || memcmp(data, CORPUS_MAGIC, 4) != 0 ||
+        loadLE(data + 4, 2) != CORPUS_VERSION) {
+        cerr << "Invalid corpus file: " << filename << endl;
+        close();
+        return false;
+    }
+
+    flags = static_cast<uint16_t>(loadLE(data + 6, 2));
+    recordSize = static_cast<uint32_t>(loadLE(data + 8, 4));
+    count = loadLE(data + 16, 8);
+    records = data + CORPUS_HEADER_SIZE;
+
+    if (recordSize != recordSizeFor(flags) || count > (length - CORPUS_HEADER_SIZE) / recordSize) {
+        cerr << "Truncated or corrupt corpus file: " << filename << endl;
+        close();
+        return false;
+    }
+    return true;
+}
+
+void CorpusReader::puzzle(const uint64_t& index, Board& board) const {
+    unpackBoard(record(index), board);
+}
+
+bool CorpusReader::solution(const uint64_t& index, Board& board) const {
+    if (!hasSolutions()) return false;
+    unpackBoard(record(index) + PACKED_BOARD_SIZE, board);
+    return true;
+}
+
+bool CorpusReader::metadata(const uint64_t& index, CorpusMetadata& metadata) const {
+    if (!hasMetadata()) return false;
+    const uint8_t* in = record(index) + recordSize - 8;
+    metadata.id = static_cast<uint32_t>(loadLE(in, 4));
+    metadata.score = static_cast<uint16_t>(loadLE(in + 4, 2));
+    metadata.difficulty = in[6];
+    metadata.technique = in[7];
+    return true;
+}
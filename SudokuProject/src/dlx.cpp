@@ -0,0 +1,210 @@
+/**
+ * @file dlx.cpp
+ * @brief Implementation of the Dancing Links Sudoku solver.
+ *
+ * Detailed function descriptions are provided in the corresponding header file.
+ *
+ * @author
+ * Keshav Bhandari
+ *
+ * @date
+ * October 16, 2026
+ */
+
+#include "../include/dlx.h"
+#include "../include/solver_engine.h"
+
+namespace {
+
+constexpr int COLUMNS = 324;
+constexpr int ROWS = 729;
+constexpr int ROOT = 0;
+constexpr int NODES = 1 + COLUMNS + ROWS * 4;
+
+/**
+ * Toroidal doubly linked exact-cover matrix stored in fixed arrays.
+ * Node 0 is the root, nodes 1-324 are the column headers and the remaining
+ * nodes are the four entries of each of the 729 candidate rows.
+ */
+class DancingLinks {
+public:
+    DancingLinks() { build(); }
+
+    template <typename Stats>
+    bool solve(Board& board, Stats& stats);
+
+private:
+    int left[NODES], right[NODES], up[NODES], down[NODES];
+    int column[NODES];   // Column header of each node
+    int rowOf[NODES];    // Candidate row (cell * 9 + digit - 1) of each node
+    int size[COLUMNS + 1];
+    int rowStart[ROWS];  // First node of each candidate row
+    int solution[81];
+
+    void build();
+    void cover(const int& c);
+    void uncover(const int& c);
+    void select(const int& row);
+    void deselect(const int& row);
+    template <typename Stats>
+    bool search(const int& depth, int& solutionSize, Stats& stats);
+};
+
+void DancingLinks::build() {
+    for (int c = 0; c <= COLUMNS; c++) {
+        left[c] = (c == 0) ? COLUMNS : c - 1;
+        right[c] = (c == COLUMNS) ? 0 : c + 1;
+        up[c] = down[c] = column[c] = c;
+        size[c] = 0;
+    }
+
+    int node = COLUMNS + 1;
+    for (int row = 0; row < ROWS; row++) {
+        const int cell = row / 9, d = row % 9;
+        const int r = cell / 9, c = cell % 9;
+        const int headers[4] = {
+            1 + cell,
+            1 + 81 + r * 9 + d,
+            1 + 162 + c * 9 + d,
+            1 + 243 + boxIndex(r, c) * 9 + d
+        };
+
+        rowStart[row] = node;
+        for (int i = 0; i < 4; i++, node++) {
+            const int header = headers[i];
+            column[node] = header;
+            rowOf[node] = row;
+
+            // Append to the bottom of the column
+            up[node] = up[header];
+            down[node] = header;
+            down[up[header]] = node;
+            up[header] = node;
+            size[header]++;
+
+            // Link the four nodes of the row in a circle
+            left[node] = (i == 0) ? node + 3 : node - 1;
+            right[node] = (i == 3) ? node - 3 : node + 1;
+        }
+    }
+}
+
+void DancingLinks::cover(const int& c) {
+    right[left[c]] = right[c];
+    left[right[c]] = left[c];
+    for (int i = down[c]; i != c; i = down[i]) {
+        for (int j = right[i]; j != i; j = right[j]) {
+            up[down[j]] = up[j];
+            down[up[j]] = down[j];
+            size[column[j]]--;
+        }
+    }
+}
+
+void DancingLinks::uncover(const int& c) {
+    for (int i = up[c]; i != c; i = up[i]) {
+        for (int j = left[i]; j != i; j = left[j]) {
+            size[column[j]]++;
+            up[down[j]] = j;
+            down[up[j]] = j;
+        }
+    }
+    right[left[c]] = c;
+    left[right[c]] = c;
+}
+
+// Takes a row into the partial solution by covering all of its columns
+void DancingLinks::select(const int& row) {
+    const int first = rowStart[row];
+    cover(column[first]);
+    for (int j = right[first]; j != first; j = right[j]) cover(column[j]);
+}
+
+void DancingLinks::deselect(const int& row) {
+    const int first = rowStart[row];
+    for (int j = left[first]; j != first; j = left[j]) uncover(column[j]);
+    uncover(column[first]);
+}
+
+template <typename Stats>
+bool DancingLinks::search(const int& depth, int& solutionSize, Stats& stats) {
+    if (right[ROOT] == ROOT) {
+        solutionSize = depth;
+        return true;
+    }
+
+    // Column heuristic: branch on the constraint with the fewest options
+    const auto timer = stats.startSelection();
+    int best = right[ROOT];
+    for (int c = right[best]; c != ROOT && size[best] > 1; c = right[c]) {
+        if (size[c] < size[best]) best = c;
+    }
+    stats.endSelection(timer);
+    if (size[best] == 0) return false;
+
+    stats.node(depth);
+    bool found = false;
+    cover(best);
+    for (int i = down[best]; i != best && !found; i = down[i]) {
+        stats.candidateCheck();
+        solution[depth] = rowOf[i];
+        for (int j = right[i]; j != i; j = right[j]) cover(column[j]);
+
+        found = search(depth + 1, solutionSize, stats);
+        if (!found) stats.backtrack();
+
+        // Always unwind so the shared matrix is pristine for the next solve
+        for (int j = left[i]; j != i; j = left[j]) uncover(column[j]);
+    }
+    uncover(best);
+    return found;
+}
+
+template <typename Stats>
+bool DancingLinks::solve(Board& board, Stats& stats) {
+    CandidateMasks masks;
+    if (!initCandidateMasks(board, masks)) {
+        return false;  // Covering a repeated given would corrupt the matrix
+    }
+
+    int givens[81];
+    int givenCount = 0;
+    for (int cell = 0; cell < 81; cell++) {
+        if (board[cell] != 0) {
+            givens[givenCount] = cell * 9 + board[cell] - 1;
+            select(givens[givenCount++]);
+        }
+    }
+
+    int solutionSize = 0;
+    const bool found = search(0, solutionSize, stats);
+    if (found) {
+        for (int i = 0; i < solutionSize; i++) {
+            board[solution[i] / 9] = static_cast<uint8_t>(solution[i] % 9 + 1);
+        }
+    }
+
+    while (givenCount > 0) {
+        deselect(givens[--givenCount]);
+    }
+    return found;
+}
+
+} // namespace
+
+// One matrix per thread, built on first use and reused by every solve
+static DancingLinks& threadMatrix() {
+    thread_local DancingLinks matrix;
+    return matrix;
+}
+
+bool solveBoardDancingLinks(Board& board) {
+    NoStats stats;
+    return threadMatrix().solve(board, stats);
+}
+
+bool solveBoardDancingLinks(Board& board, SolverStats& stats) {
+    CollectStats collect(stats);
+    stats.puzzles++;
+    return threadMatrix().solve(board, collect);
+}
@@ -27,7 +27,10 @@
  #include "../include/generator.h"
  #include "../include/sudoku.h"
  #include "../include/sudoku_io.h"
- #include <random>
+ #include "../include/board.h"
+ #include "../include/solver_engine.h"
+ #include <stdexcept>
+ #include "../include/rng.h"
  #include <bitset>
  #include <algorithm>
  
@@ -59,14 +62,13 @@
     // Temporary static return for testing
     // return {3, 1, 4, 2, 7, 6, 5, 9, 8};
 
-    vector<int> nums = {1,2,3,4,5,6,7,8,9};
-    
-    random_device rd;  
-    mt19937 g(rd());   
-
-    std::shuffle(nums.begin(), nums.end(), g); // Shuffle the vector
+    return getShuffledVector(threadRng());
+}
 
-    return nums; 
+std::vector<int> getShuffledVector(Rng& rng) {
+    vector<int> nums = {1,2,3,4,5,6,7,8,9};
+    rng.shuffle(nums.data(), 9); // Shuffle the vector
+    return nums;
 }
 
  
@@ -123,7 +125,11 @@
                  +-------+-------+-------+
              */
 
-void fillBoardWithIndependentBox(int** BOARD) {
+void fillBoardWithIndependentBox(Board& board) {
+    fillBoardWithIndependentBox(board, threadRng());
+}
+
+void fillBoardWithIndependentBox(Board& board, Rng& rng) {
     // TODO: Implement logic to fill diagonal 3x3 boxes
     /**
      * TODO:
@@ -135,32 +141,38 @@ void fillBoardWithIndependentBox(int** BOARD) {
      * - Top-Left, Center, and Bottom-Right boxes should be filled.
      * - Remaining cells should remain empty.
      */
-    vector<int>num1=getShuffledVector();
-    vector<int>num2=getShuffledVector();
-    vector<int>num3=getShuffledVector();
+    vector<int>num1=getShuffledVector(rng);
+    vector<int>num2=getShuffledVector(rng);
+    vector<int>num3=getShuffledVector(rng);
 
     int index=0;
     for(int i=0; i<3; i++){
         for(int j=0; j<3; j++){
-            BOARD[i][j]=num1[index++];
+            board.at(i, j)=num1[index++];
         }
     }
 
     index=0;
     for(int i=3; i<6; i++){
         for(int j=3; j<6; j++){
-            BOARD[i][j]=num2[index++];
+            board.at(i, j)=num2[index++];
         }
     }
 
     index=0;
     for(int i=6; i<9; i++){
         for(int j=6; j<9; j++){
-            BOARD[i][j]=num3[index++];
+            board.at(i, j)=num3[index++];
         }
     }
 }
 
+void fillBoardWithIndependentBox(int** BOARD) {
+    Board board = boardFromLegacy(BOARD);
+    fillBoardWithIndependentBox(board);
+    copyBoardToLegacy(board, BOARD);
+}
+
 
  
  // Hint 3:  SolveBoard by using function provided in sudoku.h
@@ -206,7 +218,11 @@ void fillBoardWithIndependentBox(int** BOARD) {
               */
  
  // Function to randomly delete 'n' items from a 9x9 Sudoku board using bitsets
- void deleteRandomItems(int** BOARD, const int& n) {
+ void deleteRandomItems(Board& board, const int& n) {
+    deleteRandomItems(board, n, threadRng());
+}
+
+void deleteRandomItems(Board& board, const int& n, Rng& rng) {
     if (n < 1 || n > 81) {
         throw std::invalid_argument("Number of cells to delete must be between 1 and 81");
     }
@@ -227,16 +243,10 @@ void fillBoardWithIndependentBox(int** BOARD) {
      */
     int count = 0;
     while(count < n){
-        
-        random_device rd;
-        mt19937 gen(rd());
-        uniform_int_distribution<int> dist(0,8);
-
-        int r = dist(gen);
-        int c = dist(gen);
+        const int cell = static_cast<int>(rng.nextBelow(81));
 
-        if(BOARD[r][c] != 0){
-            BOARD[r][c] = 0;
+        if(board[cell] != 0){
+            board[cell] = 0;
             count++;
         }
     }
@@ -248,12 +258,25 @@ void fillBoardWithIndependentBox(int** BOARD) {
     //     }
     // }
 }
+
+void deleteRandomItems(int** BOARD, const int& n) {
+    if (BOARD == nullptr) {
+        throw std::invalid_argument("BOARD must not be null");
+    }
+    Board board = boardFromLegacy(BOARD);
+    deleteRandomItems(board, n);
+    copyBoardToLegacy(board, BOARD);
+}
  
  
  // Finally return the board
  // Note you need add these function prototypes in generator.h files as well
  
- int** generateBoard(const int& empty_boxes) {
+ void generateBoard(Board& board, const int& empty_boxes) {
+    generateBoard(board, empty_boxes, threadRng());
+}
+
+void generateBoard(Board& board, const int& empty_boxes, Rng& rng) {
     /**
      * @brief Generates a solvable Sudoku board with a specified number of empty cells.
      *
@@ -269,7 +292,7 @@ void fillBoardWithIndependentBox(int** BOARD) {
      * - Ensure the board remains solvable after deleting cells.
      *
      * @param empty_boxes The number of cells to be emptied in the generated puzzle.
-     * @return int** A dynamically allocated 9x9 Sudoku board with 'empty_boxes' empty cells.
+     * @param board The board that receives the puzzle.
      */
 
     // Dummy implementation: Returning static sudoku board
@@ -283,10 +306,79 @@ void fillBoardWithIndependentBox(int** BOARD) {
     // BOARD[6] = new int[9] {3, 1, 0, 9, 7, 0, 2, 0, 0};
     // BOARD[7] = new int[9] {0, 0, 9, 1, 8, 2, 0, 0, 3};
     // BOARD[8] = new int[9] {0, 0, 0, 0, 6, 0, 1, 0, 0};
-    int** BOARD = getEmptyBoard();
-    fillBoardWithIndependentBox(BOARD);
-    solveBoard(BOARD,0,0);
-    deleteRandomItems(BOARD,empty_boxes);
-    
-    return BOARD;
-}
\ No newline at end of file
+    board = makeEmptyBoard();
+    fillBoardWithIndependentBox(board, rng);
+    solveBoard(board,0,0);
+    // 0 empty cells asks for a full grid; deleteRandomItems() only takes 1-81
+    if (empty_boxes > 0) {
+        deleteRandomItems(board,empty_boxes,rng);
+    }
+}
+
+int** generateBoard(const int& empty_boxes) {
+    Board board;
+    generateBoard(board, empty_boxes);
+    return boardToLegacy(board);
+}
+
+int generateUniqueBoard(Board& board, const int& empty_boxes) {
+    return generateUniqueBoard(board, empty_boxes, threadRng());
+}
+
+int generateUniqueBoard(Board& board, const int& empty_boxes, Rng& rng) {
+    board = makeEmptyBoard();
+    fillBoardWithIndependentBox(board, rng);
+    solveBoard(board, 0, 0);
+
+    int order[81];
+    for (int i = 0; i < 81; i++) order[i] = i;
+    rng.shuffle(order, 81);
+
+    // The full board is trivially unique; every accepted removal keeps it that way
+    const EngineTables& tables = engineTables();
+    int removed = 0;
+    for (int i = 0; i < 81 && removed < empty_boxes; i++) {
+        const int cell = order[i];
+        const int digit = board[cell];
+        board[cell] = 0;
+
+        // When the peers still hold the eight other digits the cell is a naked single and needs no search
+        uint16_t seen = 0;
+        for (int j = 0; j < 20; j++) {
+            const int peer = board[tables.peers[cell][j]];
+            if (peer != 0) seen |= digitBit(peer);
+        }
+        if ((seen | digitBit(digit)) != ALL_DIGITS && hasSolutionExcluding(board, cell, digit)) {
+            board[cell] = static_cast<uint8_t>(digit);  // A second solution appeared
+        } else {
+            removed++;
+        }
+    }
+    return removed;
+}
+
+bool generateBoardWithDifficulty(Board& board, const Difficulty& target) {
+    return generateBoardWithDifficulty(board, target, threadRng());
+}
+
+bool generateBoardWithDifficulty(Board& board, const Difficulty& target, Rng& rng,
+                                 const int& max_attempts, DifficultyRating* rating) {
+    // Sparser puzzles are far more likely to need the harder techniques
+    int empty_boxes;
+    switch (target) {
+        case Difficulty::Easy:   empty_boxes = 45; break;
+        case Difficulty::Medium: empty_boxes = 55; break;
+        case Difficulty::Hard:
+        case Difficulty::Expert: empty_boxes = 60; break;
+        default:                 empty_boxes = 64; break;
+    }
+
+    for (int attempt = 0; attempt < max_attempts; attempt++) {
+        generateUniqueBoard(board, empty_boxes, rng);
+        const DifficultyRating result = ratePuzzle(board);
+        // Always describes the board as it stands, including the last attempt of a miss
+        if (rating) *rating = result;
+        if (classifyDifficulty(result) == target) return true;
+    }
+    return false;
+}
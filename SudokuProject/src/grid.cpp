@@ -0,0 +1,50 @@
+/**
+ * @file grid.cpp
+ * @brief 9x9 specializations of the generic grid solver and generator.
+ *
+ * The generic templates are defined in grid_solver.h; classic 9x9 grids are
+ * routed to the specialized bitmask engine instead.
+ *
+ * @author
+ * Keshav Bhandari
+ *
+ * @date
+ * October 16, 2026
+ */
+
+#include "../include/grid_solver.h"
+#include "../include/generator.h"
+#include "../include/sudoku.h"
+#include "../include/sudoku_io.h"
+#include <algorithm>
+
+using namespace std;
+
+template <>
+bool solveGrid<3>(Grid<3>& grid) {
+    return solveBoardEfficient(grid);
+}
+
+template <>
+uint64_t countGridSolutions<3>(const Grid<3>& grid, const uint64_t& limit) {
+    return countSolutions(grid, limit);
+}
+
+template <>
+bool checkGridSolution<3>(const Grid<3>& grid) {
+    return checkIfSolutionIsValid(grid);
+}
+
+template <>
+void fillGrid<3>(Grid<3>& grid, Rng& rng) {
+    grid = makeEmptyBoard();
+    fillBoardWithIndependentBox(grid, rng);
+    solveBoardEfficient(grid);
+}
+
+template <>
+int generateGrid<3>(Grid<3>& grid, const int& empty_cells, Rng& rng, const bool& unique) {
+    if (unique) return generateUniqueBoard(grid, empty_cells, rng);
+    generateBoard(grid, empty_cells, rng);
+    return max(0, empty_cells);
+}
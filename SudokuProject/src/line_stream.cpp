@@ -0,0 +1,144 @@
+/**
+ * @file line_stream.cpp
+ * @brief Implementation of the streaming one-line puzzle solver.
+ *
+ * Detailed function descriptions are provided in the corresponding header file.
+ *
+ * @author
+ * Keshav Bhandari
+ *
+ * @date
+ * October 16, 2026
+ */
+
+#include "../include/line_stream.h"
+#include "../include/batch_solver.h"
+#include "../include/board.h"
+#include "../include/board_format.h"
+#include <cstring>
+#include <vector>
+
+using namespace std;
+
+namespace {
+
+constexpr size_t CHUNK_SIZE = 1 << 20;
+constexpr int STREAM_BATCH = BATCH_LANES * 16;
+constexpr uint8_t INVALID_CELL = 0xFF;
+
+// Cell value of every input character, so parsing a line is one lookup per cell
+struct CellTable {
+    uint8_t value[256];
+    CellTable() {
+        for (uint8_t& v : value) v = INVALID_CELL;
+        value[static_cast<uint8_t>('0')] = value[static_cast<uint8_t>('.')] = 0;
+        for (int k = 1; k <= 9; k++) value['0' + k] = static_cast<uint8_t>(k);
+    }
+};
+const CellTable CELLS;
+
+/**
+ * Collects parsed puzzles into batches for solveBoardsBatch() and buffers the
+ * output lines. Raw lines flush the pending batch first, so the output keeps
+ * the input order.
+ */
+class LineSolver {
+public:
+    LineSolver(FILE* out, LineStreamStats& stats) : writer(out, BoardFormat::Line, CHUNK_SIZE), stats(stats) {}
+
+    void addLine(const char* line, size_t length) {
+        if (length > 0 && line[length - 1] == '\r') length--;
+        if (length == 0) return;
+
+        Board& board = boards[pending];
+        bool valid = length == 81;
+        if (valid) {
+            uint8_t invalid = 0;
+            for (int i = 0; i < 81; i++) {
+                const uint8_t value = CELLS.value[static_cast<uint8_t>(line[i])];
+                board[i] = value;
+                invalid |= value & 0x80;
+            }
+            valid = invalid == 0;
+        }
+
+        if (valid) {
+            stats.puzzles++;
+            if (++pending == STREAM_BATCH) flushBatch();
+        } else {
+            stats.malformed++;
+            flushBatch();
+            writer.addLine(line, length);
+        }
+    }
+
+    void flushBatch() {
+        if (pending == 0) return;
+        solveBoardsBatch(boards, pending, solved);
+        for (int i = 0; i < pending; i++) {
+            if (solved[i]) stats.solved++;
+            else stats.unsolvable++;
+
+            // Unsolved boards are left untouched by the batch solver, so they echo the puzzle
+            writer.add(boards[i]);
+        }
+        pending = 0;
+    }
+
+    void flushOutput() {
+        writer.flush();
+    }
+
+private:
+    BoardWriter writer;
+    LineStreamStats& stats;
+    Board boards[STREAM_BATCH];
+    bool solved[STREAM_BATCH];
+    int pending = 0;
+};
+
+} // namespace
+
+LineStreamStats solveLineStream(FILE* in, FILE* out) {
+    LineStreamStats stats;
+    LineSolver solver(out, stats);
+    vector<char> input(CHUNK_SIZE);
+    size_t filled = 0;
+    bool skipping = false;  // Inside a line longer than the whole buffer
+
+    for (;;) {
+        const size_t read = fread(input.data() + filled, 1, CHUNK_SIZE - filled, in);
+        filled += read;
+
+        // Hand every complete line to the solver
+        size_t start = 0;
+        while (start < filled) {
+            const char* newline = static_cast<const char*>(memchr(input.data() + start, '\n', filled - start));
+            if (!newline) break;
+            const size_t end = static_cast<size_t>(newline - input.data());
+            if (skipping) skipping = false;
+            else solver.addLine(input.data() + start, end - start);
+            start = end + 1;
+        }
+
+        if (read == 0) {
+            // End of input: the rest is a last line without a newline
+            if (!skipping && start < filled) solver.addLine(input.data() + start, filled - start);
+            break;
+        }
+
+        // Keep the partial line for the next chunk
+        filled -= start;
+        memmove(input.data(), input.data() + start, filled);
+        if (filled == CHUNK_SIZE) {
+            if (!skipping) stats.malformed++;
+            skipping = true;
+            filled = 0;
+        }
+    }
+
+    solver.flushBatch();
+    solver.flushOutput();
+    fflush(out);
+    return stats;
+}
@@ -0,0 +1,354 @@
+/**
+ * @file pipeline.cpp
+ * @brief Implementation of the staged generate → solve → verify → write pipeline.
+ *
+ * Detailed function descriptions are provided in the corresponding header file.
+ *
+ * @author
+ * Keshav Bhandari
+ *
+ * @date
+ * October 16, 2026
+ */
+
+#include "../include/pipeline.h"
+#include "../include/board_format.h"
+#include "../include/corpus.h"
+#include "../include/generator.h"
+#include "../include/mpmc_queue.h"
+#include "../include/rng.h"
+#include "../include/sudoku_io.h"
+#include "../include/thread_pool.h"
+#include "../include/utils.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <exception>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+namespace {
+
+// A puzzle on its way through the stages
+struct PipelineItem {
+    uint32_t index = 0;
+    bool solved = false;
+    bool verified = false;
+    Board puzzle;
+    Board solution;
+    CorpusMetadata metadata;
+};
+
+using ItemQueue = BoundedQueue<PipelineItem>;
+
+// Keeps the generators at most `size` puzzles ahead of the writer, which bounds its reorder buffer
+class WriteWindow {
+public:
+    explicit WriteWindow(const size_t& size) : size(size) {}
+
+    // Blocks until puzzle `index` fits in the window; false once the run was abandoned
+    bool waitFor(const uint32_t& index) {
+        unique_lock<mutex> lock(windowMutex);
+        moved.wait(lock, [&]() { return abandoned || index - nextToWrite < size; });
+        return !abandoned;
+    }
+
+    void advance(const uint32_t& next) {
+        {
+            lock_guard<mutex> lock(windowMutex);
+            nextToWrite = next;
+        }
+        moved.notify_all();
+    }
+
+    // A lost puzzle never reaches the writer, so the window could never move past it
+    void abandon() {
+        {
+            lock_guard<mutex> lock(windowMutex);
+            abandoned = true;
+        }
+        moved.notify_all();
+    }
+
+private:
+    const size_t size;
+    mutex windowMutex;
+    condition_variable moved;
+    uint32_t nextToWrite = 0;
+    bool abandoned = false;
+};
+
+// Runs the body of a stage thread; an exception fails the run instead of terminating the process
+template <typename Body>
+void runStage(const char* name, atomic<bool>& failed, const Body& body) {
+    try {
+        body();
+    } catch (const exception& error) {
+        failed = true;
+        cerr << "Pipeline " << name << " stage failed: " << error.what() << endl;
+    }
+}
+
+// Empties a queue whose consumer failed, so its producers never block on a full queue
+void drain(ItemQueue& queue) {
+    PipelineItem skipped;
+    while (queue.pop(skipped)) {}
+}
+
+bool solutionMatches(const Board& puzzle, const Board& solution) {
+    if (!checkIfSolutionIsValid(solution)) return false;
+    for (int i = 0; i < 81; i++) {
+        if (puzzle[i] != 0 && puzzle[i] != solution[i]) return false;
+    }
+    return true;
+}
+
+/**
+ * Writes the items in the selected format. The caller hands them over in
+ * index order.
+ */
+class PipelineWriter {
+public:
+    explicit PipelineWriter(const PipelineOptions& options) : options(options) {}
+
+    ~PipelineWriter() {
+        close();
+    }
+
+    bool open() {
+        closed = false;
+        switch (options.format) {
+            case PipelineFormat::Files: {
+                string base = options.output;
+                if (!base.empty() && base.back() != '/') base += '/';
+                puzzleFolder = base + "puzzles/";
+                solutionFolder = base + "solutions/";
+                error_code error;
+                filesystem::create_directories(puzzleFolder, error);
+                if (options.solve) filesystem::create_directories(solutionFolder, error);
+                if (error) {
+                    cerr << "Unable to create folder: " << base << endl;
+                    return false;
+                }
+                return true;
+            }
+            case PipelineFormat::Line:
+                file = (options.output == "-") ? stdout : fopen(options.output.c_str(), "wb");
+                if (!file) {
+                    cerr << "Unable to open file: " << options.output << endl;
+                    return false;
+                }
+                lines.reset(new BoardWriter(file, BoardFormat::Line));
+                return true;
+            case PipelineFormat::Corpus:
+                return corpus.open(options.output, options.solve ? CORPUS_HAS_SOLUTIONS | CORPUS_HAS_METADATA
+                                                                 : CORPUS_HAS_METADATA);
+        }
+        return false;
+    }
+
+    bool write(const PipelineItem& item) {
+        const bool withSolution = options.solve && item.verified;
+        switch (options.format) {
+            case PipelineFormat::Files: {
+                bool ok = writeSudokuToFile(item.puzzle, getFileName(item.index, puzzleFolder, "PUZZLE"), false);
+                if (withSolution) {
+                    ok = writeSudokuToFile(item.solution, getFileName(item.index, solutionFolder, "SOLUTION"), false) && ok;
+                }
+                return ok;
+            }
+            case PipelineFormat::Line: {
+                char line[2 * LINE_BOARD_SIZE + 1];
+                size_t length = static_cast<size_t>(formatBoardLine(item.puzzle, line));
+                if (withSolution) {
+                    line[length++] = ',';
+                    length += static_cast<size_t>(formatBoardLine(item.solution, line + length));
+                }
+                lines->addLine(line, length);
+                return true;
+            }
+            case PipelineFormat::Corpus: {
+                // An unverified record keeps an all-zero solution
+                const Board empty{};
+                return corpus.add(item.puzzle, withSolution ? &item.solution : &empty, &item.metadata);
+            }
+        }
+        return false;
+    }
+
+    bool close() {
+        if (closed) return true;
+        closed = true;
+
+        bool ok = true;
+        if (lines) {
+            ok = lines->flush();
+            lines.reset();
+        }
+        if (file) {
+            if (file == stdout) ok = fflush(file) == 0 && ok;
+            else ok = fclose(file) == 0 && ok;
+            file = nullptr;
+        }
+        if (options.format == PipelineFormat::Corpus) {
+            ok = corpus.close() && ok;
+        }
+        return ok;
+    }
+
+private:
+    const PipelineOptions& options;
+    string puzzleFolder;
+    string solutionFolder;
+    FILE* file = nullptr;
+    unique_ptr<BoardWriter> lines;
+    CorpusWriter corpus;
+    bool closed = false;
+};
+
+} // namespace
+
+bool parsePipelineFormat(const string& name, PipelineFormat& format) {
+    if (name == "files") format = PipelineFormat::Files;
+    else if (name == "line") format = PipelineFormat::Line;
+    else if (name == "corpus") format = PipelineFormat::Corpus;
+    else return false;
+    return true;
+}
+
+bool runPipeline(const PipelineOptions& options, PipelineStats& stats) {
+    const auto start = chrono::steady_clock::now();
+    stats = PipelineStats();
+    const uint64_t seed = options.seed ? options.seed : threadRng().next();
+    stats.seed = seed;
+
+    PipelineWriter writer(options);
+    if (!writer.open()) return false;
+
+    // Generating a unique puzzle costs several solves, so most workers generate
+    const int workers = resolveThreadCount(options.threads);
+    const int solvers = options.solve ? max(1, workers / 4) : 0;
+    const int generators = max(1, workers - solvers);
+    const size_t capacity = static_cast<size_t>(max(2, options.queueCapacity));
+
+    ItemQueue generated(capacity, generators);
+    ItemQueue solved(capacity, max(1, solvers));
+    ItemQueue verified(capacity, 1);
+    ItemQueue& output = options.solve ? verified : generated;
+
+    atomic<int> nextIndex{0};
+    atomic<uint64_t> solvedCount{0};
+    atomic<uint64_t> verifiedCount{0};
+    atomic<uint64_t> offBandCount{0};
+    atomic<bool> failed{false};
+    WriteWindow window(capacity);
+    vector<thread> threads;
+
+    for (int t = 0; t < generators; t++) {
+        threads.emplace_back([&]() {
+            runStage("generate", failed, [&]() {
+                Rng rng;
+                PipelineItem item;
+                for (int i = nextIndex++; i < options.count; i = nextIndex++) {
+                    if (!window.waitFor(static_cast<uint32_t>(i))) break;
+                    // Puzzle i depends only on (seed, i), as in createAndSaveNPuzzles()
+                    rng.reseed(seed, static_cast<uint64_t>(i));
+                    item.index = static_cast<uint32_t>(i);
+                    item.metadata = CorpusMetadata();
+                    item.metadata.id = item.index;
+                    if (options.useDifficulty) {
+                        DifficultyRating rating;
+                        if (!generateBoardWithDifficulty(item.puzzle, options.difficulty, rng, 10000, &rating)) {
+                            offBandCount++;
+                            cerr << "Puzzle " << item.index << " missed the " << getDifficultyName(options.difficulty)
+                                 << " band and is written as " << getDifficultyName(classifyDifficulty(rating)) << endl;
+                        }
+                        item.metadata.score = static_cast<uint16_t>(min(rating.score, 0xFFFF));
+                        item.metadata.difficulty = static_cast<uint8_t>(classifyDifficulty(rating));
+                        item.metadata.technique = static_cast<uint8_t>(rating.hardest);
+                    } else if (options.unique) {
+                        generateUniqueBoard(item.puzzle, options.emptyBoxes, rng);
+                    } else {
+                        generateBoard(item.puzzle, options.emptyBoxes, rng);
+                    }
+                    generated.push(item);
+                }
+            });
+            if (failed) window.abandon();
+            generated.producerDone();
+        });
+    }
+
+    if (options.solve) {
+        for (int t = 0; t < solvers; t++) {
+            threads.emplace_back([&]() {
+                runStage("solve", failed, [&]() {
+                    PipelineItem item;
+                    while (generated.pop(item)) {
+                        item.solution = item.puzzle;
+                        item.solved = solve(item.solution, options.solver);
+                        if (item.solved) solvedCount++;
+                        solved.push(item);
+                    }
+                });
+                if (failed) window.abandon();
+                drain(generated);
+                solved.producerDone();
+            });
+        }
+
+        threads.emplace_back([&]() {
+            runStage("verify", failed, [&]() {
+                PipelineItem item;
+                while (solved.pop(item)) {
+                    item.verified = item.solved && solutionMatches(item.puzzle, item.solution);
+                    if (item.verified) verifiedCount++;
+                    else cerr << "Puzzle " << item.index << " has no verified solution" << endl;
+                    verified.push(item);
+                }
+            });
+            if (failed) window.abandon();
+            drain(solved);
+            verified.producerDone();
+        });
+    }
+
+    // Write on this thread, restoring index order in a ring of `capacity` slots: the window
+    // guarantees every puzzle that arrives is less than `capacity` ahead of the next one to write
+    bool ok = true;
+    uint32_t nextToWrite = 0;
+    vector<PipelineItem> ring(capacity);
+    vector<bool> present(capacity, false);
+    PipelineItem item;
+    while (output.pop(item)) {
+        stats.generated++;
+        ring[item.index % capacity] = item;
+        present[item.index % capacity] = true;
+        const uint32_t first = nextToWrite;
+        for (size_t slot = nextToWrite % capacity; present[slot]; slot = nextToWrite % capacity) {
+            // After an error keep draining, so the other stages never block on a full queue
+            if (ok && writer.write(ring[slot])) stats.written++;
+            else ok = false;
+            present[slot] = false;
+            nextToWrite++;
+        }
+        if (nextToWrite != first) window.advance(nextToWrite);
+    }
+
+    for (thread& worker : threads) worker.join();
+    ok = writer.close() && ok;
+
+    stats.offBand = offBandCount;
+    stats.solved = solvedCount;
+    stats.verified = verifiedCount;
+    stats.seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    return ok && !failed && stats.written == static_cast<uint64_t>(max(options.count, 0));
+}
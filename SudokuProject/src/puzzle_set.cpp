@@ -0,0 +1,219 @@
+/**
+ * @file puzzle_set.cpp
+ * @brief Implementation of the chunked structure-of-arrays puzzle set.
+ *
+ * Detailed function descriptions are provided in the corresponding header file.
+ *
+ * @author
+ * Keshav Bhandari
+ *
+ * @date
+ * October 16, 2026
+ */
+
+#include "../include/puzzle_set.h"
+#include "../include/batch_solver.h"
+#include "../include/corpus.h"
+#include "../include/sudoku.h"
+#include "../include/thread_pool.h"
+#include <atomic>
+#include <cstring>
+
+using namespace std;
+
+static_assert(PUZZLE_SET_CHUNK % BATCH_LANES == 0, "Batch groups must not straddle chunks");
+
+PuzzleSet::PuzzleSet(const CellLayout& layout, const uint32_t& columns)
+    : cellLayout(layout), columnFlags(columns) {}
+
+size_t PuzzleSet::bytesPerPuzzle() const {
+    const size_t board = cellLayout == CellLayout::Packed ? PACKED_BOARD_SIZE : sizeof(Board);
+    size_t bytes = board;
+    if (hasSolutions()) bytes += board;
+    if (hasStats()) bytes += sizeof(PuzzleStats);
+    if (hasFlags()) bytes += 1;
+    return bytes;
+}
+
+size_t PuzzleSet::append() {
+    if (count == chunks.size() * PUZZLE_SET_CHUNK) {
+        // One allocation per column per chunk; the optional columns start zeroed
+        Chunk chunk;
+        if (cellLayout == CellLayout::Packed) {
+            chunk.packedPuzzles.reset(new uint8_t[PUZZLE_SET_CHUNK * PACKED_BOARD_SIZE]);
+            if (hasSolutions()) chunk.packedSolutions.reset(new uint8_t[PUZZLE_SET_CHUNK * PACKED_BOARD_SIZE]());
+        } else {
+            chunk.puzzles.reset(new Board[PUZZLE_SET_CHUNK]);
+            if (hasSolutions()) chunk.solutions.reset(new Board[PUZZLE_SET_CHUNK]());
+        }
+        if (hasStats()) chunk.stats.reset(new PuzzleStats[PUZZLE_SET_CHUNK]());
+        if (hasFlags()) chunk.flags.reset(new uint8_t[PUZZLE_SET_CHUNK]());
+        chunks.push_back(move(chunk));
+    }
+    return count++;
+}
+
+size_t PuzzleSet::add(const Board& puzzle) {
+    const size_t index = append();
+    Chunk& chunk = chunks[index / PUZZLE_SET_CHUNK];
+    const size_t slot = index % PUZZLE_SET_CHUNK;
+    if (cellLayout == CellLayout::Packed) {
+        packBoard(puzzle, &chunk.packedPuzzles[slot * PACKED_BOARD_SIZE]);
+    } else {
+        chunk.puzzles[slot] = puzzle;
+    }
+    return index;
+}
+
+size_t PuzzleSet::addPacked(const uint8_t* packed, const uint8_t* packedSolution) {
+    if (cellLayout == CellLayout::Bytes) {
+        Board board;
+        unpackBoard(packed, board);
+        const size_t index = add(board);
+        if (packedSolution && hasSolutions()) unpackBoard(packedSolution, chunks[index / PUZZLE_SET_CHUNK].solutions[index % PUZZLE_SET_CHUNK]);
+        return index;
+    }
+
+    const size_t index = append();
+    Chunk& chunk = chunks[index / PUZZLE_SET_CHUNK];
+    const size_t offset = (index % PUZZLE_SET_CHUNK) * PACKED_BOARD_SIZE;
+    memcpy(&chunk.packedPuzzles[offset], packed, PACKED_BOARD_SIZE);
+    if (packedSolution && hasSolutions()) memcpy(&chunk.packedSolutions[offset], packedSolution, PACKED_BOARD_SIZE);
+    return index;
+}
+
+void PuzzleSet::clear() {
+    chunks.clear();
+    chunks.shrink_to_fit();
+    count = 0;
+}
+
+void PuzzleSet::puzzle(const size_t& index, Board& board) const {
+    const Chunk& chunk = chunks[index / PUZZLE_SET_CHUNK];
+    const size_t slot = index % PUZZLE_SET_CHUNK;
+    if (cellLayout == CellLayout::Packed) {
+        unpackBoard(&chunk.packedPuzzles[slot * PACKED_BOARD_SIZE], board);
+    } else {
+        board = chunk.puzzles[slot];
+    }
+}
+
+bool PuzzleSet::solution(const size_t& index, Board& board) const {
+    if (!hasSolutions()) return false;
+    const Chunk& chunk = chunks[index / PUZZLE_SET_CHUNK];
+    const size_t slot = index % PUZZLE_SET_CHUNK;
+    if (cellLayout == CellLayout::Packed) {
+        unpackBoard(&chunk.packedSolutions[slot * PACKED_BOARD_SIZE], board);
+    } else {
+        board = chunk.solutions[slot];
+    }
+    return true;
+}
+
+bool PuzzleSet::setSolution(const size_t& index, const Board& board) {
+    if (!hasSolutions()) return false;
+    Chunk& chunk = chunks[index / PUZZLE_SET_CHUNK];
+    const size_t slot = index % PUZZLE_SET_CHUNK;
+    if (cellLayout == CellLayout::Packed) {
+        packBoard(board, &chunk.packedSolutions[slot * PACKED_BOARD_SIZE]);
+    } else {
+        chunk.solutions[slot] = board;
+    }
+    return true;
+}
+
+PuzzleStats* PuzzleSet::stats(const size_t& index) {
+    if (!hasStats()) return nullptr;
+    return &chunks[index / PUZZLE_SET_CHUNK].stats[index % PUZZLE_SET_CHUNK];
+}
+
+uint8_t PuzzleSet::flags(const size_t& index) const {
+    if (!hasFlags()) return 0;
+    return chunks[index / PUZZLE_SET_CHUNK].flags[index % PUZZLE_SET_CHUNK];
+}
+
+void PuzzleSet::setFlags(const size_t& index, const uint8_t& value) {
+    if (!hasFlags()) return;
+    chunks[index / PUZZLE_SET_CHUNK].flags[index % PUZZLE_SET_CHUNK] = value;
+}
+
+PuzzleBlock PuzzleSet::block(const size_t& index) const {
+    const Chunk& chunk = chunks[index];
+    PuzzleBlock view;
+    view.first = index * PUZZLE_SET_CHUNK;
+    view.count = min(PUZZLE_SET_CHUNK, count - view.first);
+    view.packedPuzzles = chunk.packedPuzzles.get();
+    view.packedSolutions = chunk.packedSolutions.get();
+    view.puzzles = chunk.puzzles.get();
+    view.solutions = chunk.solutions.get();
+    view.stats = chunk.stats.get();
+    view.flags = chunk.flags.get();
+    return view;
+}
+
+// Solves puzzles [start, start + lanes) of a block and writes back every column the set stores
+static int solveGroup(const PuzzleBlock& block, const size_t& start, const int& lanes) {
+    Board scratch[BATCH_LANES];
+    // Byte layout with solutions: solve directly inside the solution column
+    Board* boards = block.solutions ? block.solutions + start : scratch;
+    for (int i = 0; i < lanes; i++) {
+        if (block.puzzles) {
+            boards[i] = block.puzzles[start + i];
+        } else {
+            unpackBoard(block.packedPuzzles + (start + i) * PACKED_BOARD_SIZE, boards[i]);
+        }
+    }
+
+    bool solved[BATCH_LANES];
+    int total = 0;
+    if (block.stats) {
+        for (int i = 0; i < lanes; i++) {
+            SolverStats counters;
+            solved[i] = solveBoardEfficient(boards[i], counters);
+            block.stats[start + i].nodes = static_cast<uint32_t>(counters.nodes);
+            block.stats[start + i].backtracks = static_cast<uint32_t>(counters.backtracks);
+            total += solved[i];
+        }
+    } else {
+        total = solveBoardsBatch(boards, lanes, solved);
+    }
+
+    for (int i = 0; i < lanes; i++) {
+        // A failed solve leaves a partly propagated board behind; store an empty one instead
+        if (!solved[i]) boards[i] = Board{};
+        if (block.packedSolutions) packBoard(boards[i], block.packedSolutions + (start + i) * PACKED_BOARD_SIZE);
+        if (block.flags) {
+            uint8_t& flags = block.flags[start + i];
+            flags = static_cast<uint8_t>((flags & ~(PUZZLE_SOLVED | PUZZLE_UNSOLVABLE)) | (solved[i] ? PUZZLE_SOLVED : PUZZLE_UNSOLVABLE));
+        }
+    }
+    return total;
+}
+
+size_t solvePuzzleSet(PuzzleSet& set, const int& threads) {
+    const size_t groups = (set.size() + BATCH_LANES - 1) / BATCH_LANES;
+    const size_t groupsPerChunk = PUZZLE_SET_CHUNK / BATCH_LANES;
+    vector<PuzzleBlock> blocks;
+    for (size_t b = 0; b < set.blockCount(); b++) blocks.push_back(set.block(b));
+
+    atomic<size_t> total{0};
+    parallelFor(static_cast<int>(groups), threads, [&](int group) {
+        const PuzzleBlock& block = blocks[group / groupsPerChunk];
+        const size_t start = (group % groupsPerChunk) * BATCH_LANES;
+        const int lanes = static_cast<int>(min<size_t>(BATCH_LANES, block.count - start));
+        total.fetch_add(static_cast<size_t>(solveGroup(block, start, lanes)), memory_order_relaxed);
+    });
+    return total.load();
+}
+
+bool loadPuzzleSet(const string& filename, PuzzleSet& set) {
+    CorpusReader reader;
+    if (!reader.open(filename)) return false;
+
+    const bool withSolutions = reader.hasSolutions() && set.hasSolutions();
+    for (uint64_t i = 0; i < reader.size(); i++) {
+        const uint8_t* record = reader.record(i);
+        set.addPacked(record, withSolutions ? record + PACKED_BOARD_SIZE : nullptr);
+    }
+    return true;
+}
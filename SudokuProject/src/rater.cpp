@@ -0,0 +1,319 @@
+/**
+ * @file rater.cpp
+ * @brief Implementation of the technique-based difficulty rater.
+ *
+ * Detailed function descriptions are provided in the corresponding header file.
+ *
+ * @author
+ * Keshav Bhandari
+ *
+ * @date
+ * October 16, 2026
+ */
+
+#include "../include/rater.h"
+#include "../include/solver_engine.h"
+
+const char* getTechniqueName(const Technique& technique) {
+    switch (technique) {
+        case Technique::HiddenSingle:     return "hidden single";
+        case Technique::NakedSingle:      return "naked single";
+        case Technique::LockedCandidates: return "locked candidates";
+        case Technique::NakedPair:        return "naked pair";
+        case Technique::HiddenPair:       return "hidden pair";
+        case Technique::NakedTriple:      return "naked triple";
+        case Technique::HiddenTriple:     return "hidden triple";
+        case Technique::XWing:            return "X-wing";
+        case Technique::Swordfish:        return "swordfish";
+        case Technique::Guessing:         return "guessing";
+        default:                          return "none";
+    }
+}
+
+const char* getDifficultyName(const Difficulty& difficulty) {
+    switch (difficulty) {
+        case Difficulty::Medium:  return "medium";
+        case Difficulty::Hard:    return "hard";
+        case Difficulty::Expert:  return "expert";
+        case Difficulty::Extreme: return "extreme";
+        default:                  return "easy";
+    }
+}
+
+int getTechniqueWeight(const Technique& technique) {
+    // Loosely follows the Sudoku Explainer scale, in tenths
+    switch (technique) {
+        case Technique::HiddenSingle:     return 12;
+        case Technique::NakedSingle:      return 23;
+        case Technique::LockedCandidates: return 26;
+        case Technique::NakedPair:        return 30;
+        case Technique::HiddenPair:       return 34;
+        case Technique::NakedTriple:      return 36;
+        case Technique::HiddenTriple:     return 40;
+        case Technique::XWing:            return 42;
+        case Technique::Swordfish:        return 48;
+        case Technique::Guessing:         return 100;
+        default:                          return 0;
+    }
+}
+
+Difficulty classifyDifficulty(const DifficultyRating& rating) {
+    if (!rating.solved) return Difficulty::Extreme;
+    switch (rating.hardest) {
+        case Technique::LockedCandidates: return Difficulty::Medium;
+        case Technique::NakedPair:
+        case Technique::HiddenPair:
+        case Technique::NakedTriple:
+        case Technique::HiddenTriple:     return Difficulty::Hard;
+        case Technique::XWing:
+        case Technique::Swordfish:        return Difficulty::Expert;
+        case Technique::Guessing:         return Difficulty::Extreme;
+        default:                          return Difficulty::Easy;
+    }
+}
+
+namespace {
+
+// Outcome of one technique pass: how many steps it applied, or a contradiction
+struct StepResult {
+    int applied = 0;
+    bool contradiction = false;
+};
+
+/**
+ * Looks for `n` items (cells, digits or lines, indexed 0-8) whose masks together
+ * cover exactly `n` bits, and calls apply(items, cover) for each such subset until
+ * one call returns true. Items with an empty mask or more than `n` bits are skipped.
+ */
+template <typename Apply>
+bool findSubset(const uint16_t* masks, const int& n, const int& start, const int& chosen,
+                const uint16_t& items, const uint16_t& cover, Apply& apply) {
+    if (chosen == n) {
+        return countDigits(cover) == n && apply(items, cover);
+    }
+    for (int i = start; i < 9; i++) {
+        if (masks[i] == 0 || countDigits(masks[i]) > n) continue;
+        const uint16_t grown = cover | masks[i];
+        if (countDigits(grown) > n) continue;
+        if (findSubset(masks, n, i + 1, chosen + 1, static_cast<uint16_t>(items | (1u << i)), grown, apply)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Removes `digits` from a cell; reports whether something changed and whether the cell died
+inline bool eliminate(SearchState& state, const int& cell, const uint16_t& digits, StepResult& result) {
+    if (!(state.candidates[cell] & digits)) return false;
+    if (!eliminateCandidates(state, cell, digits)) result.contradiction = true;
+    return true;
+}
+
+StepResult applyHiddenSingles(SearchState& state) {
+    const EngineTables& tables = engineTables();
+    StepResult result;
+    for (int u = 0; u < 27 && !result.contradiction; u++) {
+        const uint8_t* unit = tables.units[u];
+        uint16_t once = 0, twice = 0;
+        for (int j = 0; j < 9; j++) {
+            const uint16_t options = state.candidates[unit[j]];
+            twice |= once & options;
+            once |= options;
+        }
+        const uint16_t exactlyOnce = static_cast<uint16_t>(once & ~twice);
+        for (int j = 0; j < 9 && exactlyOnce; j++) {
+            const uint16_t hidden = state.candidates[unit[j]] & exactlyOnce;
+            if (!hidden) continue;
+            if (countDigits(hidden) > 1 || !assignDigit(state, unit[j], lowestDigit(hidden))) {
+                result.contradiction = true;
+                break;
+            }
+            result.applied++;
+        }
+    }
+    return result;
+}
+
+StepResult applyNakedSingles(SearchState& state) {
+    StepResult result;
+    for (int cell = 0; cell < 81; cell++) {
+        if (state.board[cell] != 0 || countDigits(state.candidates[cell]) != 1) continue;
+        if (!assignDigit(state, cell, lowestDigit(state.candidates[cell]))) {
+            result.contradiction = true;
+            break;
+        }
+        result.applied++;
+    }
+    return result;
+}
+
+StepResult applyLockedCandidates(SearchState& state) {
+    const EngineTables& tables = engineTables();
+    StepResult result;
+    for (const Intersection& section : tables.intersections) {
+        uint16_t segment = 0, lineRest = 0, boxRest = 0;
+        for (int j = 0; j < 3; j++) segment |= state.candidates[section.segment[j]];
+        if (!segment) continue;
+        for (int j = 0; j < 6; j++) {
+            lineRest |= state.candidates[section.lineRest[j]];
+            boxRest |= state.candidates[section.boxRest[j]];
+        }
+
+        const uint16_t pointing = static_cast<uint16_t>(segment & ~boxRest & lineRest);
+        const uint16_t claiming = static_cast<uint16_t>(segment & ~lineRest & boxRest);
+        if (!pointing && !claiming) continue;
+
+        for (int j = 0; j < 6; j++) {
+            if (pointing) eliminate(state, section.lineRest[j], pointing, result);
+            if (claiming) eliminate(state, section.boxRest[j], claiming, result);
+        }
+        result.applied = 1;
+        return result;
+    }
+    return result;
+}
+
+// Naked subsets: n cells of a unit whose candidates are n digits own those digits
+StepResult applyNakedSubset(SearchState& state, const int& n) {
+    const EngineTables& tables = engineTables();
+    StepResult result;
+    for (int u = 0; u < 27; u++) {
+        const uint8_t* unit = tables.units[u];
+        uint16_t masks[9];
+        for (int j = 0; j < 9; j++) masks[j] = state.candidates[unit[j]];
+
+        auto apply = [&](const uint16_t& cells, const uint16_t& digits) {
+            bool changed = false;
+            for (int j = 0; j < 9; j++) {
+                if (!(cells & (1u << j))) changed |= eliminate(state, unit[j], digits, result);
+            }
+            return changed;
+        };
+        if (findSubset(masks, n, 0, 0, 0, 0, apply)) {
+            result.applied = 1;
+            return result;
+        }
+    }
+    return result;
+}
+
+// Hidden subsets: n digits of a unit that fit only in the same n cells clear those cells
+StepResult applyHiddenSubset(SearchState& state, const int& n) {
+    const EngineTables& tables = engineTables();
+    StepResult result;
+    for (int u = 0; u < 27; u++) {
+        const uint8_t* unit = tables.units[u];
+        uint16_t places[9] = {};
+        for (int j = 0; j < 9; j++) {
+            for (uint16_t options = state.candidates[unit[j]]; options; options &= options - 1) {
+                places[lowestDigit(options) - 1] |= static_cast<uint16_t>(1u << j);
+            }
+        }
+
+        auto apply = [&](const uint16_t& digits, const uint16_t& cells) {
+            bool changed = false;
+            for (int j = 0; j < 9; j++) {
+                if (cells & (1u << j)) changed |= eliminate(state, unit[j], static_cast<uint16_t>(~digits & ALL_DIGITS), result);
+            }
+            return changed;
+        };
+        if (findSubset(places, n, 0, 0, 0, 0, apply)) {
+            result.applied = 1;
+            return result;
+        }
+    }
+    return result;
+}
+
+// Fish: a digit confined to the same n columns in n rows leaves the rest of those columns (and transposed)
+StepResult applyFish(SearchState& state, const int& n) {
+    StepResult result;
+    for (int k = 1; k <= 9; k++) {
+        const uint16_t bit = digitBit(k);
+        for (int transposed = 0; transposed < 2; transposed++) {
+            // masks[line] holds the positions of digit k across the line
+            uint16_t masks[9] = {};
+            for (int line = 0; line < 9; line++) {
+                for (int pos = 0; pos < 9; pos++) {
+                    const int cell = transposed ? pos * 9 + line : line * 9 + pos;
+                    if (state.candidates[cell] & bit) masks[line] |= static_cast<uint16_t>(1u << pos);
+                }
+            }
+
+            auto apply = [&](const uint16_t& lines, const uint16_t& positions) {
+                bool changed = false;
+                for (int line = 0; line < 9; line++) {
+                    if (lines & (1u << line)) continue;
+                    for (int pos = 0; pos < 9; pos++) {
+                        if (!(positions & (1u << pos))) continue;
+                        const int cell = transposed ? pos * 9 + line : line * 9 + pos;
+                        changed |= eliminate(state, cell, bit, result);
+                    }
+                }
+                return changed;
+            };
+            if (findSubset(masks, n, 0, 0, 0, 0, apply)) {
+                result.applied = 1;
+                return result;
+            }
+        }
+    }
+    return result;
+}
+
+StepResult applyTechnique(SearchState& state, const Technique& technique) {
+    switch (technique) {
+        case Technique::HiddenSingle:     return applyHiddenSingles(state);
+        case Technique::NakedSingle:      return applyNakedSingles(state);
+        case Technique::LockedCandidates: return applyLockedCandidates(state);
+        case Technique::NakedPair:        return applyNakedSubset(state, 2);
+        case Technique::HiddenPair:       return applyHiddenSubset(state, 2);
+        case Technique::NakedTriple:      return applyNakedSubset(state, 3);
+        case Technique::HiddenTriple:     return applyHiddenSubset(state, 3);
+        case Technique::XWing:            return applyFish(state, 2);
+        case Technique::Swordfish:        return applyFish(state, 3);
+        default:                          return {};
+    }
+}
+
+constexpr Technique TECHNIQUES[] = {
+    Technique::HiddenSingle, Technique::NakedSingle, Technique::LockedCandidates,
+    Technique::NakedPair, Technique::HiddenPair, Technique::NakedTriple,
+    Technique::HiddenTriple, Technique::XWing, Technique::Swordfish
+};
+
+} // namespace
+
+DifficultyRating ratePuzzle(const Board& board) {
+    DifficultyRating rating;
+    SearchState state;
+    if (!initSearchState(state, board)) {
+        return rating;  // Contradictory givens
+    }
+
+    while (state.emptyCount > 0) {
+        // A cell without candidates can never be filled by any technique
+        if (state.buckets[0][0] || state.buckets[0][1]) return rating;
+
+        bool progress = false;
+        for (const Technique& technique : TECHNIQUES) {
+            const StepResult step = applyTechnique(state, technique);
+            if (step.contradiction) return rating;
+            if (step.applied == 0) continue;
+
+            rating.steps += step.applied;
+            rating.score += step.applied * getTechniqueWeight(technique);
+            if (technique > rating.hardest) rating.hardest = technique;
+            progress = true;
+            break;
+        }
+
+        if (!progress) {
+            rating.hardest = Technique::Guessing;
+            return rating;
+        }
+    }
+
+    rating.solved = true;
+    return rating;
+}
@@ -0,0 +1,81 @@
+/**
+ * @file resumable_solver.cpp
+ * @brief Implementation of the iterative, budget-limited solver.
+ *
+ * Detailed function descriptions are provided in the corresponding header file.
+ *
+ * @author
+ * Keshav Bhandari
+ *
+ * @date
+ * October 16, 2026
+ */
+
+#include "../include/resumable_solver.h"
+#include <chrono>
+
+using namespace std;
+
+// How many guesses pass between two reads of the clock
+static const uint64_t CLOCK_CHECK_INTERVAL = 8;
+
+const char* getSolveStatusName(const SolveStatus& status) {
+    switch (status) {
+        case SolveStatus::Solved:     return "solved";
+        case SolveStatus::Unsolvable: return "unsolvable";
+        default:                      return "budget exceeded";
+    }
+}
+
+void ResumableSolver::reset(const Board& board) {
+    depth = 0;
+    needCell = true;
+    nodeCount = 0;
+    current = SolveStatus::BudgetExceeded;
+    if (!initSearchState(state, board) || !propagate(state)) current = SolveStatus::Unsolvable;
+}
+
+SolveStatus ResumableSolver::run(const SolveBudget& budget) {
+    if (current != SolveStatus::BudgetExceeded) return current;
+
+    const auto start = chrono::steady_clock::now();
+    uint64_t spent = 0;
+    while (true) {
+        if (needCell) {
+            const int cell = selectCell(state);
+            if (cell == -1) return current = SolveStatus::Solved;
+            frames[depth++] = {static_cast<uint8_t>(cell), state.candidates[cell], state.trailSize};
+            needCell = false;
+        }
+
+        // Undo the previous guess at this choice point (nothing on the first visit or after a pause)
+        Frame& frame = frames[depth - 1];
+        undoTrail(state, frame.mark);
+        if (!frame.untried) {
+            if (--depth == 0) return current = SolveStatus::Unsolvable;
+            continue;
+        }
+
+        // Pausing here leaves the state exactly as a resumed call expects it
+        if (budget.maxNodes && spent >= budget.maxNodes) return current;
+        if (budget.cancel && budget.cancel->isCancelled()) return current;
+        if (budget.maxMicros && spent % CLOCK_CHECK_INTERVAL == 0 &&
+            chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start).count() >=
+                static_cast<long long>(budget.maxMicros)) {
+            return current;
+        }
+
+        const int k = lowestDigit(frame.untried);
+        frame.untried &= frame.untried - 1;
+        spent++;
+        nodeCount++;
+        if (assignDigit(state, frame.cell, k) && propagate(state)) needCell = true;
+    }
+}
+
+SolveStatus solveBoardBounded(Board& board, const SolveBudget& budget) {
+    ResumableSolver solver(board);
+    const SolveStatus status = solver.run(budget);
+    if (status == SolveStatus::Solved) board = solver.solution();
+    return status;
+}
@@ -0,0 +1,107 @@
+/**
+ * @file rng.cpp
+ * @brief Implementation of the xoshiro256** generator and per-thread streams.
+ *
+ * Detailed function descriptions are provided in the corresponding header file.
+ *
+ * @author
+ * Keshav Bhandari
+ *
+ * @date
+ * October 16, 2026
+ */
+
+#include "../include/rng.h"
+#include <atomic>
+#include <mutex>
+#include <random>
+
+using namespace std;
+
+// SplitMix64 step, used to expand a seed into the xoshiro state
+static uint64_t splitMix64(uint64_t& x) {
+    uint64_t z = (x += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+void Rng::reseed(const uint64_t& seed, const uint64_t& stream) {
+    uint64_t mixer = stream;
+    uint64_t x = seed ^ splitMix64(mixer);
+    for (uint64_t& word : state) {
+        word = splitMix64(x);
+    }
+}
+
+uint32_t Rng::nextBelow(const uint32_t& bound) {
+    uint64_t product = static_cast<uint64_t>(static_cast<uint32_t>(next() >> 32)) * bound;
+    uint32_t low = static_cast<uint32_t>(product);
+    if (low < bound) {
+        const uint32_t threshold = static_cast<uint32_t>(-bound) % bound;
+        while (low < threshold) {
+            product = static_cast<uint64_t>(static_cast<uint32_t>(next() >> 32)) * bound;
+            low = static_cast<uint32_t>(product);
+        }
+    }
+    return static_cast<uint32_t>(product >> 32);
+}
+
+void Rng::jump() {
+    static const uint64_t JUMP[] = {0x180EC6D33CFD0ABAULL, 0xD5A61266F0C9392CULL,
+                                    0xA9582618E03FC9AAULL, 0x39ABDC4529B1661CULL};
+    uint64_t s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+    for (uint64_t word : JUMP) {
+        for (int b = 0; b < 64; b++) {
+            if (word & (uint64_t(1) << b)) {
+                s0 ^= state[0];
+                s1 ^= state[1];
+                s2 ^= state[2];
+                s3 ^= state[3];
+            }
+            next();
+        }
+    }
+    state[0] = s0;
+    state[1] = s1;
+    state[2] = s2;
+    state[3] = s3;
+}
+
+static mutex globalSeedMutex;
+static bool globalSeedSet = false;
+static uint64_t globalSeed = 0;
+static atomic<uint64_t> nextThreadStream{0};
+
+void setGlobalRngSeed(const uint64_t& seed) {
+    lock_guard<mutex> lock(globalSeedMutex);
+    globalSeed = seed;
+    globalSeedSet = true;
+    nextThreadStream = 0;
+}
+
+static Rng makeThreadRng() {
+    uint64_t seed;
+    {
+        lock_guard<mutex> lock(globalSeedMutex);
+        if (!globalSeedSet) {
+            // One random_device read per process instead of one per draw
+            random_device rd;
+            globalSeed = (static_cast<uint64_t>(rd()) << 32) | rd();
+            globalSeedSet = true;
+        }
+        seed = globalSeed;
+    }
+
+    Rng rng(seed);
+    const uint64_t stream = nextThreadStream++;
+    for (uint64_t i = 0; i < stream; i++) {
+        rng.jump();
+    }
+    return rng;
+}
+
+Rng& threadRng() {
+    thread_local Rng rng = makeThreadRng();
+    return rng;
+}
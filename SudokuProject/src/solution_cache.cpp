@@ -0,0 +1,143 @@
+/**
+ * @file solution_cache.cpp
+ * @brief Implementation of the sharded solution cache.
+ *
+ * Detailed function descriptions are provided in the corresponding header file.
+ *
+ * @author
+ * Keshav Bhandari
+ *
+ * @date
+ * October 16, 2026
+ */
+
+#include "../include/solution_cache.h"
+#include "../include/canonical.h"
+#include <memory>
+#include <vector>
+
+using namespace std;
+
+size_t SolutionCache::BoardHash::operator()(const Board& board) const {
+    // FNV-1a over the 81 cells
+    uint64_t hash = 1469598103934665603ULL;
+    for (int i = 0; i < 81; i++) {
+        hash ^= board[i];
+        hash *= 1099511628211ULL;
+    }
+    return static_cast<size_t>(hash);
+}
+
+SolutionCache::SolutionCache(const size_t& capacity, const int& shard_count) {
+    const int count = shard_count > 0 ? shard_count : 1;
+    for (int i = 0; i < count; i++) shards.emplace_back(new Shard());
+    shardCapacity = capacity / count > 0 ? capacity / count : 1;
+}
+
+SolutionCache::Shard& SolutionCache::shardOf(const Board& canonical) {
+    const size_t hash = BoardHash()(canonical);
+    // The low bits pick the bucket inside the shard, so the shard comes from the high bits
+    return *shards[(static_cast<uint64_t>(hash) >> 32) % shards.size()];
+}
+
+bool SolutionCache::find(const Board& canonical, Board& solution) {
+    Shard& shard = shardOf(canonical);
+    {
+        lock_guard<mutex> lock(shard.mutex);
+        auto it = shard.index.find(canonical);
+        if (it != shard.index.end()) {
+            shard.entries.splice(shard.entries.begin(), shard.entries, it->second);
+            solution = it->second->second;
+            hitCount.fetch_add(1, memory_order_relaxed);
+            return true;
+        }
+    }
+    missCount.fetch_add(1, memory_order_relaxed);
+    return false;
+}
+
+void SolutionCache::insert(const Board& canonical, const Board& solution) {
+    Shard& shard = shardOf(canonical);
+    lock_guard<mutex> lock(shard.mutex);
+
+    auto it = shard.index.find(canonical);
+    if (it != shard.index.end()) {
+        // Another thread solved the same puzzle first
+        shard.entries.splice(shard.entries.begin(), shard.entries, it->second);
+        return;
+    }
+    if (shard.entries.size() >= shardCapacity) {
+        shard.index.erase(shard.entries.back().first);
+        shard.entries.pop_back();
+    }
+    shard.entries.emplace_front(canonical, solution);
+    shard.index.emplace(canonical, shard.entries.begin());
+}
+
+size_t SolutionCache::size() const {
+    size_t total = 0;
+    for (const auto& shard : shards) {
+        lock_guard<mutex> lock(shard->mutex);
+        total += shard->entries.size();
+    }
+    return total;
+}
+
+void SolutionCache::clear() {
+    for (const auto& shard : shards) {
+        lock_guard<mutex> lock(shard->mutex);
+        shard->index.clear();
+        shard->entries.clear();
+    }
+    hitCount.store(0, memory_order_relaxed);
+    missCount.store(0, memory_order_relaxed);
+}
+
+int solveThroughCache(Board* boards, const int& count, bool* solved, SolutionCache& cache,
+                      const function<void(Board*, int, bool*)>& solveMisses) {
+    vector<Board> canonicals(count);
+    vector<BoardTransform> transforms(count);
+    vector<char> keyed(count, 0);
+    vector<Board> misses;
+    vector<int> missIndex;
+    int total = 0;
+
+    for (int i = 0; i < count; i++) {
+        int givens = 0;
+        for (int j = 0; j < 81; j++) givens += boards[i][j] != 0;
+        // Too few givens for a unique solution; such boards are rarely repeated and slow to canonicalize
+        if (givens >= 17) {
+            keyed[i] = 1;
+            canonicals[i] = canonicalForm(boards[i], &transforms[i]);
+            Board solution;
+            if (cache.find(canonicals[i], solution)) {
+                boards[i] = invertTransform(solution, transforms[i]);
+                if (solved) solved[i] = true;
+                total++;
+                continue;
+            }
+        }
+        missIndex.push_back(i);
+        misses.push_back(boards[i]);
+    }
+    if (misses.empty()) return total;
+
+    const int missCount = static_cast<int>(misses.size());
+    unique_ptr<bool[]> missSolved(new bool[missCount]());
+    solveMisses(misses.data(), missCount, missSolved.get());
+    for (int m = 0; m < missCount; m++) {
+        const int i = missIndex[m];
+        boards[i] = misses[m];
+        if (solved) solved[i] = missSolved[m];
+        if (!missSolved[m]) continue;
+        total++;
+        if (keyed[i]) cache.insert(canonicals[i], applyTransform(boards[i], transforms[i]));
+    }
+    return total;
+}
+
+bool solve(Board& board, const SolverType& solver, SolutionCache& cache) {
+    return solveThroughCache(&board, 1, nullptr, cache, [&solver](Board* boards, int, bool* solved) {
+        solved[0] = solve(boards[0], solver);
+    }) == 1;
+}
@@ -0,0 +1,268 @@
+/**
+ * @file solver_engine.cpp
+ * @brief Implementation of the bitmask candidate engine.
+ *
+ * Detailed function descriptions are provided in the corresponding header file.
+ *
+ * @author
+ * Keshav Bhandari
+ *
+ * @date
+ * October 16, 2026
+ */
+
+#include "../include/solver_engine.h"
+
+bool initCandidateMasks(const Board& board, CandidateMasks& masks) {
+    for (int i = 0; i < 9; i++) {
+        masks.rows[i] = 0;
+        masks.cols[i] = 0;
+        masks.boxes[i] = 0;
+    }
+
+    for (int r = 0; r < 9; r++) {
+        for (int c = 0; c < 9; c++) {
+            const int k = board.at(r, c);
+            if (k == 0) continue;
+            if (k > 9) return false;
+
+            // A repeated digit in any unit can never lead to a solution
+            if (getCandidates(masks, r, c) & digitBit(k)) {
+                placeDigit(masks, r, c, k);
+            } else {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static EngineTables buildEngineTables() {
+    EngineTables tables{};
+    for (int cell = 0; cell < 81; cell++) {
+        const int r = cell / 9, c = cell % 9;
+        int count = 0;
+        for (int other = 0; other < 81; other++) {
+            if (other == cell) continue;
+            const int r2 = other / 9, c2 = other % 9;
+            if (r2 == r || c2 == c || boxIndex(r2, c2) == boxIndex(r, c)) {
+                tables.peers[cell][count++] = static_cast<uint8_t>(other);
+            }
+        }
+    }
+
+    for (int i = 0; i < 9; i++) {
+        for (int j = 0; j < 9; j++) {
+            tables.units[i][j] = static_cast<uint8_t>(i * 9 + j);                                         // Row i
+            tables.units[9 + i][j] = static_cast<uint8_t>(j * 9 + i);                                     // Column i
+            tables.units[18 + i][j] = static_cast<uint8_t>((3 * (i / 3) + j / 3) * 9 + 3 * (i % 3) + j % 3); // Box i
+        }
+    }
+
+    // Every line (row or column) crosses three boxes
+    int index = 0;
+    for (int line = 0; line < 18; line++) {
+        for (int b = 0; b < 9; b++) {
+            const bool crosses = (line < 9) ? (line / 3 == b / 3) : ((line - 9) / 3 == b % 3);
+            if (!crosses) continue;
+
+            Intersection section{};
+            int nSegment = 0, nLine = 0, nBox = 0;
+            for (int j = 0; j < 9; j++) {
+                const uint8_t cell = tables.units[line][j];
+                if (boxIndex(cell / 9, cell % 9) == b) section.segment[nSegment++] = cell;
+                else section.lineRest[nLine++] = cell;
+            }
+
+            for (int j = 0; j < 9; j++) {
+                const uint8_t cell = tables.units[18 + b][j];
+                const bool onLine = (line < 9) ? (cell / 9 == line) : (cell % 9 == line - 9);
+                if (!onLine) section.boxRest[nBox++] = cell;
+            }
+            tables.intersections[index++] = section;
+        }
+    }
+    return tables;
+}
+
+const EngineTables& engineTables() {
+    static const EngineTables tables = buildEngineTables();
+    return tables;
+}
+
+// Adds or removes a cell from the MRV bucket of the given candidate count
+static inline void bucketInsert(SearchState& state, const int& cell, const int& count) {
+    state.buckets[count][cell >> 6] |= uint64_t(1) << (cell & 63);
+}
+
+static inline void bucketRemove(SearchState& state, const int& cell, const int& count) {
+    state.buckets[count][cell >> 6] &= ~(uint64_t(1) << (cell & 63));
+}
+
+bool initSearchState(SearchState& state, const Board& board) {
+    state.board = board;
+    state.trailSize = 0;
+    state.emptyCount = 0;
+    for (auto& bucket : state.buckets) {
+        bucket[0] = 0;
+        bucket[1] = 0;
+    }
+
+    if (!initCandidateMasks(board, state.masks)) {
+        return false;
+    }
+
+    for (int cell = 0; cell < 81; cell++) {
+        if (board[cell] != 0) {
+            state.candidates[cell] = 0;
+            continue;
+        }
+        const uint16_t options = getCandidates(state.masks, cell / 9, cell % 9);
+        state.candidates[cell] = options;
+        bucketInsert(state, cell, countDigits(options));
+        state.emptyCount++;
+    }
+    return true;
+}
+
+bool assignDigit(SearchState& state, const int& cell, const int& k) {
+    const uint16_t previous = state.candidates[cell];
+    state.trail[state.trailSize++] = {static_cast<uint8_t>(cell), static_cast<uint8_t>(k), previous};
+    bucketRemove(state, cell, countDigits(previous));
+    state.candidates[cell] = 0;
+    state.board[cell] = static_cast<uint8_t>(k);
+    placeDigit(state.masks, cell / 9, cell % 9, k);
+    state.emptyCount--;
+
+    // Filled peers have no candidates left, so only empty peers are touched
+    const uint16_t bit = digitBit(k);
+    const uint8_t* peers = engineTables().peers[cell];
+    bool consistent = true;
+    for (int i = 0; i < 20; i++) {
+        const int peer = peers[i];
+        const uint16_t options = state.candidates[peer];
+        if (!(options & bit)) continue;
+
+        state.trail[state.trailSize++] = {static_cast<uint8_t>(peer), 0, options};
+        const int count = countDigits(options);
+        bucketRemove(state, peer, count);
+        bucketInsert(state, peer, count - 1);
+        state.candidates[peer] = static_cast<uint16_t>(options & ~bit);
+        if (count == 1) consistent = false;
+    }
+    return consistent;
+}
+
+void undoTrail(SearchState& state, const int& mark) {
+    while (state.trailSize > mark) {
+        const TrailEntry& entry = state.trail[--state.trailSize];
+        const int cell = entry.cell;
+        if (entry.digit != 0) {
+            // Revert an assignment: the cell becomes empty again
+            state.board[cell] = 0;
+            removeDigit(state.masks, cell / 9, cell % 9, entry.digit);
+            state.emptyCount++;
+        } else {
+            bucketRemove(state, cell, countDigits(state.candidates[cell]));
+        }
+        state.candidates[cell] = entry.mask;
+        bucketInsert(state, cell, countDigits(entry.mask));
+    }
+}
+
+bool eliminateCandidates(SearchState& state, const int& cell, const uint16_t& digits) {
+    const uint16_t options = state.candidates[cell];
+    if (!(options & digits)) return true;
+
+    state.trail[state.trailSize++] = {static_cast<uint8_t>(cell), 0, options};
+    const uint16_t remaining = static_cast<uint16_t>(options & ~digits);
+    bucketRemove(state, cell, countDigits(options));
+    bucketInsert(state, cell, countDigits(remaining));
+    state.candidates[cell] = remaining;
+    return remaining != 0;
+}
+
+// Returns the used-digit mask of unit u (rows 0-8, columns 9-17, boxes 18-26)
+static inline uint16_t placedInUnit(const SearchState& state, const int& u) {
+    if (u < 9) return state.masks.rows[u];
+    if (u < 18) return state.masks.cols[u - 9];
+    return state.masks.boxes[u - 18];
+}
+
+// Places every hidden single; sets progress when at least one digit was placed
+static bool applyHiddenSingles(SearchState& state, bool& progress) {
+    const EngineTables& tables = engineTables();
+    for (int u = 0; u < 27; u++) {
+        const uint8_t* unit = tables.units[u];
+        uint16_t once = 0, twice = 0;
+        for (int j = 0; j < 9; j++) {
+            const uint16_t options = state.candidates[unit[j]];
+            twice |= once & options;
+            once |= options;
+        }
+
+        // Some digit is neither placed nor possible anywhere in the unit
+        if ((once | placedInUnit(state, u)) != ALL_DIGITS) return false;
+
+        const uint16_t exactlyOnce = static_cast<uint16_t>(once & ~twice);
+        if (!exactlyOnce) continue;
+
+        for (int j = 0; j < 9; j++) {
+            const uint16_t hidden = state.candidates[unit[j]] & exactlyOnce;
+            if (!hidden) continue;
+            if (countDigits(hidden) > 1) return false;  // One cell would need two digits
+            if (!assignDigit(state, unit[j], lowestDigit(hidden))) return false;
+            progress = true;
+        }
+    }
+    return true;
+}
+
+// Removes pointing and claiming candidates; sets progress when a candidate was removed
+static bool applyLockedCandidates(SearchState& state, bool& progress) {
+    const EngineTables& tables = engineTables();
+    for (const Intersection& section : tables.intersections) {
+        uint16_t segment = 0, lineRest = 0, boxRest = 0;
+        for (int j = 0; j < 3; j++) segment |= state.candidates[section.segment[j]];
+        if (!segment) continue;
+        for (int j = 0; j < 6; j++) {
+            lineRest |= state.candidates[section.lineRest[j]];
+            boxRest |= state.candidates[section.boxRest[j]];
+        }
+
+        // Pointing: inside the box the digit only fits on this line
+        const uint16_t pointing = static_cast<uint16_t>(segment & ~boxRest & lineRest);
+        // Claiming: inside the line the digit only fits in this box
+        const uint16_t claiming = static_cast<uint16_t>(segment & ~lineRest & boxRest);
+        if (!pointing && !claiming) continue;
+
+        for (int j = 0; j < 6; j++) {
+            if (pointing && !eliminateCandidates(state, section.lineRest[j], pointing)) return false;
+            if (claiming && !eliminateCandidates(state, section.boxRest[j], claiming)) return false;
+        }
+        progress = true;
+    }
+    return true;
+}
+
+bool propagate(SearchState& state) {
+    for (;;) {
+        // Naked singles: keep draining the one-candidate bucket
+        for (;;) {
+            int cell;
+            if (state.buckets[1][0]) cell = lowestBitIndex(state.buckets[1][0]);
+            else if (state.buckets[1][1]) cell = 64 + lowestBitIndex(state.buckets[1][1]);
+            else break;
+            if (!assignDigit(state, cell, lowestDigit(state.candidates[cell]))) return false;
+        }
+        if (state.buckets[0][0] || state.buckets[0][1]) return false;
+        if (state.emptyCount == 0) return true;
+
+        bool progress = false;
+        if (!applyHiddenSingles(state, progress)) return false;
+        if (progress) continue;
+
+        if (!applyLockedCandidates(state, progress)) return false;
+        if (!progress) return true;
+    }
+}
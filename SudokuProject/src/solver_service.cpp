@@ -0,0 +1,572 @@
+/**
+ * @file solver_service.cpp
+ * @brief Implementation of the micro-batching solver service.
+ *
+ * Detailed function descriptions are provided in the corresponding header file.
+ *
+ * @author
+ * Keshav Bhandari
+ *
+ * @date
+ * October 16, 2026
+ */
+
+#include "../include/solver_service.h"
+#include "../include/batch_solver.h"
+#include "../include/board_format.h"
+#include "../include/mpmc_queue.h"
+#include "../include/resumable_solver.h"
+#include "../include/solution_cache.h"
+#include "../include/sudoku.h"
+#include "../include/sudoku_io.h"
+#include "../include/thread_pool.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <iostream>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <cerrno>
+#include <csignal>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+#if defined(_WIN32)
+
+bool runSolverService(const ServiceOptions&, ServiceStats& stats) {
+    stats = ServiceStats();
+    cerr << "The solver service needs Unix domain sockets and is not available on this platform" << endl;
+    return false;
+}
+
+#else
+
+namespace {
+
+using Clock = chrono::steady_clock;
+
+// Guesses a lone solve request gets on the dispatcher before it moves to the parallel search
+constexpr uint64_t LONE_SOLVE_NODES = 256;
+
+// Responses a client may leave unread before it is disconnected
+constexpr size_t MAX_UNSENT_BYTES = 1 << 20;
+
+// How long a send to a client that stopped reading may block before it is disconnected
+constexpr int SEND_TIMEOUT_SECONDS = 5;
+
+bool writeFully(const int& fd, const bool& socket, const char* data, size_t length) {
+    while (length > 0) {
+        const ssize_t n = socket ? ::send(fd, data, length, MSG_NOSIGNAL) : ::write(fd, data, length);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return false;
+        data += n;
+        length -= static_cast<size_t>(n);
+    }
+    return true;
+}
+
+/**
+ * A client: an accepted socket, or stdin and stdout.
+ * Its reader thread queues requests and its writer thread sends the responses,
+ * so the dispatcher only appends to `unsent` and never waits on a slow client.
+ */
+struct Connection {
+    int in;
+    int out;
+    bool socket;
+    atomic<bool> finished{false};   // Set when the reader stops
+    atomic<bool> closed{false};     // Set when the writer stops, after the last response
+
+    Connection(const int& in, const int& out, const bool& socket) : in(in), out(out), socket(socket) {}
+    ~Connection() {
+        if (socket) ::close(in);
+    }
+
+    // Called by the reader before it queues a request
+    void expectResponse() {
+        lock_guard<mutex> lock(outputMutex);
+        inFlight++;
+    }
+
+    // Called by the reader when it stops
+    void readerDone() {
+        {
+            lock_guard<mutex> lock(outputMutex);
+            finished = true;
+        }
+        outputReady.notify_one();
+    }
+
+    // Called by the dispatcher with the frames of `responses` requests
+    void respond(const string& frames, const int& responses) {
+        {
+            lock_guard<mutex> lock(outputMutex);
+            inFlight -= responses;
+            if (!broken && unsent.size() + frames.size() > MAX_UNSENT_BYTES) disconnect();
+            if (!broken) unsent += frames;
+        }
+        outputReady.notify_one();
+    }
+
+    // Sends responses until the reader stopped and every queued request was answered
+    void writeResponses() {
+        string sending;
+        unique_lock<mutex> lock(outputMutex);
+        for (;;) {
+            outputReady.wait(lock, [this]() { return !unsent.empty() || (finished && inFlight == 0); });
+            if (unsent.empty()) break;
+            sending.swap(unsent);
+            lock.unlock();
+            const bool sent = writeFully(out, socket, sending.data(), sending.size());
+            sending.clear();
+            lock.lock();
+            if (!sent && !broken) disconnect();
+        }
+        closed = true;
+    }
+
+private:
+    mutex outputMutex;
+    condition_variable outputReady;
+    string unsent;
+    int inFlight = 0;
+    bool broken = false;   // Responses are dropped once the client is gone or too far behind
+
+    // Drops the client; the reader and the writer see the socket closing (outputMutex held)
+    void disconnect() {
+        broken = true;
+        unsent.clear();
+        if (socket) ::shutdown(in, SHUT_RDWR);
+    }
+};
+
+enum class RequestKind : uint8_t { Solve, Validate, Stats, Ping, Invalid };
+
+struct Request {
+    shared_ptr<Connection> connection;
+    RequestKind kind = RequestKind::Invalid;
+    Clock::time_point received;
+    Board board;
+    string error;   // Message of an Invalid request
+};
+
+using RequestQueue = BoundedQueue<Request>;
+
+atomic<bool> stopRequested{false};
+
+void requestStop(int) {
+    stopRequested.store(true);
+}
+
+bool readFully(const int& fd, uint8_t* data, size_t length) {
+    while (length > 0) {
+        const ssize_t n = ::read(fd, data, length);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return false;
+        data += n;
+        length -= static_cast<size_t>(n);
+    }
+    return true;
+}
+
+void appendFrame(string& out, const string& payload) {
+    const uint32_t length = static_cast<uint32_t>(payload.size());
+    const char header[4] = {static_cast<char>(length >> 24), static_cast<char>(length >> 16),
+                            static_cast<char>(length >> 8), static_cast<char>(length)};
+    out.append(header, 4);
+    out += payload;
+}
+
+void parseRequest(const char* payload, const size_t& length, Request& request) {
+    size_t command = 0;
+    while (command < length && payload[command] != ' ') command++;
+    const string name(payload, command);
+    const char* text = payload + min(command + 1, length);
+    const size_t textLength = length - min(command + 1, length);
+
+    request.error.clear();
+    if (name == "solve" || name == "validate") {
+        request.kind = name == "solve" ? RequestKind::Solve : RequestKind::Validate;
+        const ParseStatus status = parseBoard(text, textLength, request.board);
+        if (!status.ok()) {
+            request.kind = RequestKind::Invalid;
+            request.error = getParseErrorMessage(status.error);
+            if (status.line) request.error += " at " + to_string(status.line) + ":" + to_string(status.column);
+        }
+    } else if (name == "stats" && textLength == 0) {
+        request.kind = RequestKind::Stats;
+    } else if (name == "ping" && textLength == 0) {
+        request.kind = RequestKind::Ping;
+    } else {
+        request.kind = RequestKind::Invalid;
+        request.error = "unknown command";
+    }
+}
+
+// Reads the frames of one connection until it is closed, then marks it finished
+void readRequests(const shared_ptr<Connection>& connection, RequestQueue& queue) {
+    vector<char> payload(SERVICE_MAX_FRAME);
+    Request request;
+    request.connection = connection;
+    for (;;) {
+        uint8_t header[4];
+        if (!readFully(connection->in, header, 4)) break;
+        const uint32_t length = (uint32_t(header[0]) << 24) | (uint32_t(header[1]) << 16) |
+                                (uint32_t(header[2]) << 8) | uint32_t(header[3]);
+        if (length > SERVICE_MAX_FRAME) {
+            // The stream cannot be resynchronized: answer, then stop reading
+            request.received = Clock::now();
+            request.kind = RequestKind::Invalid;
+            request.error = "frame too large";
+            connection->expectResponse();
+            queue.push(request);
+            break;
+        }
+        if (!readFully(connection->in, reinterpret_cast<uint8_t*>(payload.data()), length)) break;
+        request.received = Clock::now();
+        parseRequest(payload.data(), length, request);
+        connection->expectResponse();
+        queue.push(request);
+    }
+    connection->readerDone();
+}
+
+/**
+ * Forms micro-batches from the queue, solves them and writes the responses.
+ * Runs on its own thread; the pool is only used for batches of several groups.
+ */
+class Dispatcher {
+public:
+    Dispatcher(const ServiceOptions& options, RequestQueue& queue, ServiceStats& stats)
+        : options(options), queue(queue), stats(stats), pool(options.threads),
+          boards(static_cast<size_t>(max(1, options.maxBatch))),
+          solved(new bool[max(1, options.maxBatch)]),
+          exceeded(new bool[max(1, options.maxBatch)]),
+          solutionCounts(static_cast<size_t>(max(1, options.maxBatch))) {
+        if (options.cacheCapacity > 0) cache.reset(new SolutionCache(static_cast<size_t>(options.cacheCapacity)));
+        // Build the solver tables before the first request needs them
+        Board warm = makeEmptyBoard();
+        solveBoardEfficient(warm);
+        warm.at(0, 0) = 0;
+        solveBoardsBatch(&warm, 1);
+        countSolutions(warm, 2);
+    }
+
+    void run() {
+        const size_t maxBatch = static_cast<size_t>(max(1, options.maxBatch));
+        vector<Request> batch;
+        batch.reserve(maxBatch);
+        Request request;
+        while (queue.pop(request)) {
+            batch.clear();
+            batch.push_back(request);
+            const Clock::time_point deadline = Clock::now() + chrono::microseconds(max(0, options.maxDelayMicros));
+            while (batch.size() < maxBatch) {
+                if (queue.tryPop(request)) batch.push_back(request);
+                else if (Clock::now() < deadline) this_thread::yield();
+                else break;
+            }
+            process(batch);
+        }
+        if (cache) {
+            stats.cacheHits = cache->hits();
+            stats.cacheMisses = cache->misses();
+        }
+    }
+
+private:
+    const ServiceOptions& options;
+    RequestQueue& queue;
+    ServiceStats& stats;
+    ThreadPool pool;
+    vector<Board> boards;
+    unique_ptr<bool[]> solved;
+    unique_ptr<bool[]> exceeded;
+    vector<uint64_t> solutionCounts;
+    unique_ptr<SolutionCache> cache;   // Only with ServiceOptions::cacheCapacity
+
+    // Solves n boards with `solver`, through the solution cache when the service keeps one
+    template <typename Solver>
+    void solveBoards(Board* first, const int& n, bool* flags, const Solver& solver) {
+        if (cache) solveThroughCache(first, n, flags, *cache, solver);
+        else solver(first, n, flags);
+    }
+
+    // Solves boards [first, first + lanes) within the per-request budget
+    void solveWithBudget(const int& first, const int& lanes) {
+        SolveBudget budget;
+        budget.maxMicros = static_cast<uint64_t>(options.solveBudgetMicros);
+        for (int i = first; i < first + lanes; i++) {
+            // A cache hit never reaches the solver, so it is never cut off
+            exceeded[i] = false;
+            solveBoards(&boards[i], 1, &solved[i], [&](Board* board, int, bool* flags) {
+                const SolveStatus status = solveBoardBounded(*board, budget);
+                flags[0] = status == SolveStatus::Solved;
+                exceeded[i] = status == SolveStatus::BudgetExceeded;
+            });
+        }
+    }
+
+    // Solves one board alone: easy puzzles finish on the dispatcher, hard ones are split across the pool
+    bool solveLone(Board& board) {
+        ResumableSolver solver(board);
+        SolveBudget budget;
+        budget.maxNodes = LONE_SOLVE_NODES;
+        const SolveStatus status = solver.run(budget);
+        if (status == SolveStatus::BudgetExceeded) return solveBoardParallel(board, pool);
+        if (status == SolveStatus::Solved) board = solver.solution();
+        return status == SolveStatus::Solved;
+    }
+
+    void process(vector<Request>& batch) {
+        const int count = static_cast<int>(batch.size());
+        int solves = 0;
+        for (int i = 0; i < count; i++) {
+            if (batch[i].kind == RequestKind::Solve) boards[solves++] = batch[i].board;
+        }
+        const int groups = (solves + BATCH_LANES - 1) / BATCH_LANES;
+
+        // Solve groups first, then one task per validation
+        vector<int> validations;
+        for (int i = 0; i < count; i++) {
+            if (batch[i].kind == RequestKind::Validate) validations.push_back(i);
+        }
+        auto runTask = [&](const int& task) {
+            if (task < groups) {
+                const int first = task * BATCH_LANES;
+                const int lanes = min(BATCH_LANES, solves - first);
+                if (options.solveBudgetMicros > 0) {
+                    solveWithBudget(first, lanes);
+                } else {
+                    solveBoards(&boards[first], lanes, &solved[first], [](Board* group, int n, bool* flags) {
+                        solveBoardsBatch(group, n, flags);
+                    });
+                    fill(&exceeded[first], &exceeded[first] + lanes, false);
+                }
+            } else {
+                const int v = task - groups;
+                solutionCounts[v] = countSolutions(batch[validations[v]].board, 2);
+            }
+        };
+        const int tasks = groups + static_cast<int>(validations.size());
+        // A solve that throws fails the solves and validations of its batch, not the service
+        string failure;
+        try {
+            if (tasks == 1 && solves == 1 && options.solveBudgetMicros <= 0 && pool.size() > 1) {
+                exceeded[0] = false;
+                solveBoards(&boards[0], 1, &solved[0], [this](Board* board, int, bool* flags) { flags[0] = solveLone(*board); });
+            } else if (tasks <= 1) {
+                for (int task = 0; task < tasks; task++) runTask(task);
+            } else {
+                for (int task = 0; task < tasks; task++) pool.submit([&runTask, task]() { runTask(task); });
+                pool.wait();
+            }
+        } catch (const exception& e) {
+            failure = string("solver failed: ") + e.what();
+        } catch (...) {
+            failure = "solver failed";
+        }
+
+        // Responses of one connection are coalesced into a single hand-off to its writer
+        struct Output {
+            Connection* connection;
+            string frames;
+            int responses;
+        };
+        vector<Output> outputs;
+        int solveIndex = 0, validateIndex = 0;
+        char line[LINE_BOARD_SIZE];
+        char micros[32];
+        for (Request& request : batch) {
+            const double latency = chrono::duration<double, micro>(Clock::now() - request.received).count();
+            snprintf(micros, sizeof(micros), "%.1f", latency);
+            string payload;
+            switch (request.kind) {
+                case RequestKind::Solve:
+                    if (!failure.empty()) {
+                        payload = string("error ") + micros + " " + failure;
+                    } else if (solved[solveIndex]) {
+                        formatBoardLine(boards[solveIndex], line);
+                        payload = string("solved ") + micros + " " + string(line, LINE_BOARD_SIZE);
+                    } else if (exceeded[solveIndex]) {
+                        payload = string("exceeded ") + micros;
+                    } else {
+                        payload = string("unsolvable ") + micros;
+                    }
+                    solveIndex++;
+                    break;
+                case RequestKind::Validate: {
+                    const uint64_t solutions = solutionCounts[validateIndex++];
+                    if (!failure.empty()) payload = string("error ") + micros + " " + failure;
+                    else payload = string(solutions == 0 ? "unsolvable " : solutions == 1 ? "unique " : "multiple ") + micros;
+                    break;
+                }
+                case RequestKind::Stats: {
+                    char text[160];
+                    snprintf(text, sizeof(text), "stats requests %llu batches %llu mean_us %.1f max_us %.1f",
+                             static_cast<unsigned long long>(stats.requests),
+                             static_cast<unsigned long long>(stats.batches),
+                             stats.requests ? stats.totalMicros / static_cast<double>(stats.requests) : 0.0,
+                             stats.maxMicros);
+                    payload = text;
+                    if (cache) {
+                        snprintf(text, sizeof(text), " cache_hits %llu cache_misses %llu",
+                                 static_cast<unsigned long long>(cache->hits()),
+                                 static_cast<unsigned long long>(cache->misses()));
+                        payload += text;
+                    }
+                    break;
+                }
+                case RequestKind::Ping:
+                    payload = "pong";
+                    break;
+                case RequestKind::Invalid:
+                    payload = string("error ") + micros + " " + request.error;
+                    break;
+            }
+
+            stats.requests++;
+            stats.totalMicros += latency;
+            stats.maxMicros = max(stats.maxMicros, latency);
+
+            Connection* connection = request.connection.get();
+            auto it = find_if(outputs.begin(), outputs.end(),
+                              [connection](const Output& output) { return output.connection == connection; });
+            if (it == outputs.end()) it = outputs.insert(outputs.end(), Output{connection, string(), 0});
+            appendFrame(it->frames, payload);
+            it->responses++;
+        }
+        stats.batches++;
+
+        // A client that went away or stopped reading only loses its own responses
+        for (const Output& output : outputs) output.connection->respond(output.frames, output.responses);
+    }
+};
+
+struct Client {
+    thread reader;
+    thread writer;
+    shared_ptr<Connection> connection;
+};
+
+Client startClient(const shared_ptr<Connection>& connection, RequestQueue& queue) {
+    Client client;
+    client.connection = connection;
+    client.reader = thread(readRequests, connection, ref(queue));
+    client.writer = thread([connection]() { connection->writeResponses(); });
+    return client;
+}
+
+void joinClient(Client& client) {
+    client.reader.join();
+    client.writer.join();
+}
+
+bool serveSocket(const ServiceOptions& options, RequestQueue& queue, ServiceStats& stats) {
+    sockaddr_un address;
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if (options.socketPath.size() >= sizeof(address.sun_path)) {
+        cerr << "Socket path too long: " << options.socketPath << endl;
+        return false;
+    }
+    memcpy(address.sun_path, options.socketPath.c_str(), options.socketPath.size() + 1);
+
+    const int listener = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listener < 0) {
+        cerr << "Unable to create socket: " << strerror(errno) << endl;
+        return false;
+    }
+    ::unlink(options.socketPath.c_str());
+    if (::bind(listener, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 || ::listen(listener, 128) != 0) {
+        cerr << "Unable to listen on " << options.socketPath << ": " << strerror(errno) << endl;
+        ::close(listener);
+        return false;
+    }
+    cerr << "Listening on " << options.socketPath << endl;
+
+    list<Client> clients;
+    while (!stopRequested.load()) {
+        pollfd waiting = {listener, POLLIN, 0};
+        const int ready = ::poll(&waiting, 1, 100);
+
+        for (auto it = clients.begin(); it != clients.end();) {
+            if (!it->connection->closed) {
+                ++it;
+                continue;
+            }
+            joinClient(*it);
+            it = clients.erase(it);
+        }
+
+        if (ready <= 0) continue;
+        const int fd = ::accept(listener, nullptr, nullptr);
+        if (fd < 0) continue;
+        stats.connections++;
+        // A client that stops reading cannot hold its writer forever
+        const timeval timeout = {SEND_TIMEOUT_SECONDS, 0};
+        ::setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+        clients.push_back(startClient(make_shared<Connection>(fd, fd, true), queue));
+    }
+
+    ::close(listener);
+    ::unlink(options.socketPath.c_str());
+    // Wake up the readers; the writers still send the answers of the requests already queued
+    for (Client& client : clients) ::shutdown(client.connection->in, SHUT_RD);
+    for (Client& client : clients) joinClient(client);
+    return true;
+}
+
+} // namespace
+
+bool runSolverService(const ServiceOptions& options, ServiceStats& stats) {
+    stats = ServiceStats();
+    stopRequested = false;
+
+    RequestQueue queue(static_cast<size_t>(max(2, options.queueCapacity)));
+    Dispatcher dispatcher(options, queue, stats);
+    thread worker([&dispatcher]() { dispatcher.run(); });
+
+    // Closed clients must not kill the service
+    struct sigaction ignore, stop, oldPipe, oldInt, oldTerm;
+    memset(&ignore, 0, sizeof(ignore));
+    memset(&stop, 0, sizeof(stop));
+    ignore.sa_handler = SIG_IGN;
+    stop.sa_handler = requestStop;
+    sigaction(SIGPIPE, &ignore, &oldPipe);
+
+    bool ok = true;
+    if (options.socketPath.empty()) {
+        stats.connections = 1;
+        Client client = startClient(make_shared<Connection>(STDIN_FILENO, STDOUT_FILENO, false), queue);
+        joinClient(client);
+    } else {
+        sigaction(SIGINT, &stop, &oldInt);
+        sigaction(SIGTERM, &stop, &oldTerm);
+        ok = serveSocket(options, queue, stats);
+        sigaction(SIGINT, &oldInt, nullptr);
+        sigaction(SIGTERM, &oldTerm, nullptr);
+    }
+
+    queue.producerDone();
+    worker.join();
+    sigaction(SIGPIPE, &oldPipe, nullptr);
+    return ok;
+}
+
+#endif
@@ -3,8 +3,10 @@
  * @brief Implementation of core Sudoku solving and validation functions.
  *
  * Contains the logic for validating moves and solving Sudoku puzzles using
- * a backtracking algorithm. Detailed function descriptions are provided in
- * the corresponding header file.
+ * a backtracking algorithm. Both solvers work on the contiguous `Board` type
+ * and draw their candidates from the row/column/box masks of solver_engine.h
+ * instead of scanning the board; the `int**` overloads are thin adapters.
+ * Detailed function descriptions are provided in the corresponding header file.
  *
  * @author
  * Keshav Bhandari
@@ -14,8 +16,18 @@
 */
 
 #include "../include/sudoku.h"
+#include "../include/solver_engine.h"
+#include "../include/dlx.h"
+#include "../include/resumable_solver.h"
+#include "../include/thread_pool.h"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
 #include <iostream>
+#include <mutex>
 #include <tuple>
+#include <vector>
 using namespace std;
 
 bool isValid(int** BOARD, const int& r, const int& c, const int& k)
@@ -44,112 +56,502 @@ bool isValid(int** BOARD, const int& r, const int& c, const int& k)
     return true;  // Placement is valid
 }
 
-bool solveBoard(int** BOARD, const int& r, const int& c)
+bool isValid(const Board& board, const int& r, const int& c, const int& k)
+{
+    for (int i = 0; i < 9; i++)
+    {
+        if (k == board.at(r, i) || k == board.at(i, c))
+            return false;
+    }
+
+    const int startRow = 3 * (r / 3);
+    const int startCol = 3 * (c / 3);
+    for (int i = startRow; i < startRow + 3; i++)
+    {
+        for (int j = startCol; j < startCol + 3; j++)
+        {
+            if (k == board.at(i, j))
+                return false;
+        }
+    }
+
+    return true;
+}
+
+// Recursive row-major backtracking over the used-digit masks
+template <typename Stats>
+static bool solveBoardMasked(Board& board, CandidateMasks& masks, int r, int c, Stats& stats, const int& depth)
 {
+    // Skip already filled cells without recursing on each of them
+    const auto timer = stats.startSelection();
+    while (r < 9 && board.at(r, c) != 0)
+    {
+        if (++c == 9) { c = 0; r++; }
+    }
+    stats.endSelection(timer);
+
     // If we've reached beyond the last row, the board is solved
     if (r == 9)
         return true;
 
-    // Move to the next row if we've reached the end of the current row
-    if (c == 9)
-        return solveBoard(BOARD, r + 1, 0);
-
-    // Skip already filled cells and move to the next column
-    if (BOARD[r][c] != 0)
-        return solveBoard(BOARD, r, c + 1);
+    stats.node(depth);
+    const int nextRow = (c == 8) ? r + 1 : r;
+    const int nextCol = (c == 8) ? 0 : c + 1;
 
-    // Try placing numbers 1 to 9 in the current empty cell
-    for (int k = 1; k <= 9; k++)
+    // Try every digit that is still free in the row, column and box
+    for (uint16_t options = getCandidates(masks, r, c); options; options &= options - 1)
     {
-        if (isValid(BOARD, r, c, k))
-        {
-            BOARD[r][c] = k;  // Place number 'k'
+        const int k = lowestDigit(options);
+        stats.candidateCheck();
+        board.at(r, c) = k;  // Place number 'k'
+        placeDigit(masks, r, c, k);
 
-            // Recursively attempt to solve the rest of the board
-            if (solveBoard(BOARD, r, c + 1))
-                return true;  // Found a valid solution
+        // Recursively attempt to solve the rest of the board
+        if (solveBoardMasked(board, masks, nextRow, nextCol, stats, depth + 1))
+            return true;  // Found a valid solution
 
-            // Backtrack: Remove the number if no solution is found
-            BOARD[r][c] = 0;
-        }
+        // Backtrack: Remove the number if no solution is found
+        stats.backtrack();
+        removeDigit(masks, r, c, k);
+        board.at(r, c) = 0;
     }
 
     // Trigger backtracking if no valid number can be placed
     return false;
 }
 
+template <typename Stats>
+static bool solveBoardFrom(Board& board, const int& r, const int& c, Stats& stats)
+{
+    CandidateMasks masks;
+    if (!initCandidateMasks(board, masks))
+        return false;  // Contradictory givens
+
+    // Move to the next row if we've been asked to start past the last column
+    if (c == 9)
+        return solveBoardMasked(board, masks, r + 1, 0, stats, 0);
+    return solveBoardMasked(board, masks, r, c, stats, 0);
+}
+
+bool solveBoard(Board& board, const int& r, const int& c)
+{
+    NoStats stats;
+    return solveBoardFrom(board, r, c, stats);
+}
+
+bool solveBoard(Board& board, SolverStats& stats)
+{
+    CollectStats collect(stats);
+    stats.puzzles++;
+    return solveBoardFrom(board, 0, 0, collect);
+}
+
+bool solveBoard(int** BOARD, const int& r, const int& c)
+{
+    Board board = boardFromLegacy(BOARD);
+    if (!solveBoard(board, r, c))
+        return false;  // A failed search leaves the board untouched
+
+    copyBoardToLegacy(board, BOARD);
+    return true;
+}
+
+tuple<int, int, int> findNextCell(const Board& board) {
+    SearchState state;
+    if (!initSearchState(state, board)) {
+        return {-1, -1, 0};  // The givens repeat a digit, so no cell is worth choosing
+    }
 
+    const int cell = selectCell(state);
+    if (cell == -1) {
+        return {-1, -1, 10};
+    }
+    return {cell / 9, cell % 9, countDigits(state.candidates[cell])};
+}
 
 tuple<int, int, int> findNextCell(int** BOARD) {
-    int minOptions = 10; // More than max i.e 9
-    int bestRow = -1, bestCol = -1;
-
-    for (int r = 0; r < 9; r++) {
-        for (int c = 0; c < 9; c++) {
-            if (BOARD[r][c] == 0) {  
-                int optionsCount = 0;
-                for (int k = 1; k <= 9; k++) {
-                    if (isValid(BOARD, r, c, k)) {
-                        optionsCount++;
-                    }
-                }
-                
-                
-                if (optionsCount == 0) {
-                    return {r, c, 0};
-                }
-                
-                
-                if (optionsCount < minOptions) {
-                    minOptions = optionsCount;
-                    bestRow = r;
-                    bestCol = c;
-                    
-                    
-                    if (optionsCount == 1) {
-                        return {r, c, 1};
-                    }
-                }
+    return findNextCell(boardFromLegacy(BOARD));
+}
+
+// MRV search: propagation runs after every guess, the trail undoes both
+template <typename Stats>
+static bool solveBoardEfficientSearch(SearchState& state, Stats& stats, const int& depth) {
+    const auto timer = stats.startSelection();
+    const int cell = selectCell(state);
+    stats.endSelection(timer);
+
+    if (cell == -1) {
+        return true;
+    }
+
+    stats.node(depth);
+    for (uint16_t candidates = state.candidates[cell]; candidates; candidates &= candidates - 1) {
+        const int mark = state.trailSize;
+
+        stats.candidateCheck();
+        if (assignDigit(state, cell, lowestDigit(candidates))) {
+            stats.propagation();
+            if (propagate(state) && solveBoardEfficientSearch(state, stats, depth + 1)) {
+                return true;
             }
         }
+
+        stats.backtrack();
+        undoTrail(state, mark);
+    }
+
+    // Also reached right away when the chosen cell has no candidates left
+    return false;
+}
+
+template <typename Stats>
+static bool solveBoardEfficientWith(Board& board, Stats& stats) {
+    SearchState state;
+    if (!initSearchState(state, board)) {
+        return false;  // Contradictory givens
+    }
+    stats.propagation();
+    if (!propagate(state) || !solveBoardEfficientSearch(state, stats, 0)) {
+        return false;
     }
-    return {bestRow, bestCol, minOptions};
+    board = state.board;
+    return true;
+}
+
+bool solveBoardEfficient(Board& board) {
+    NoStats stats;
+    return solveBoardEfficientWith(board, stats);
+}
+
+bool solveBoardEfficient(Board& board, SolverStats& stats) {
+    CollectStats collect(stats);
+    stats.puzzles++;
+    return solveBoardEfficientWith(board, collect);
 }
 
 bool solveBoardEfficient(int** BOARD) {
-    
-    auto [row, col, options] = findNextCell(BOARD);
-    
-    
-    if (row == -1) {
-        return true;
+    Board board = boardFromLegacy(BOARD);
+    if (!solveBoardEfficient(board)) {
+        return false;
+    }
+    copyBoardToLegacy(board, BOARD);
+    return true;
+}
+
+// Same search as above, but visits every solution until onSolution() returns false
+template <typename OnSolution>
+static bool enumerateSolutionsSearch(SearchState& state, OnSolution& onSolution) {
+    const int cell = selectCell(state);
+
+    if (cell == -1) {
+        return onSolution(state.board);
     }
-    
-    
-    if (options == 0) {
+
+    for (uint16_t candidates = state.candidates[cell]; candidates; candidates &= candidates - 1) {
+        const int mark = state.trailSize;
+
+        bool keepGoing = true;
+        if (assignDigit(state, cell, lowestDigit(candidates)) && propagate(state)) {
+            keepGoing = enumerateSolutionsSearch(state, onSolution);
+        }
+
+        undoTrail(state, mark);
+        if (!keepGoing) return false;
+    }
+    return true;
+}
+
+bool hasUniqueSolution(const Board& board) {
+    SearchState state;
+    if (!initSearchState(state, board) || !propagate(state)) {
         return false;
     }
-    
-    
-    for (int k = 1; k <= 9; k++) {
-        if (isValid(BOARD, row, col, k)) {
-            
-            BOARD[row][col] = k;
-            
-            
-            if (solveBoardEfficient(BOARD)) {
-                return true;  
+    int count = 0;
+    auto countToTwo = [&count](const Board&) { return ++count < 2; };
+    enumerateSolutionsSearch(state, countToTwo);
+    return count == 1;
+}
+
+bool hasSolutionExcluding(const Board& board, const int& cell, const int& k) {
+    SearchState state;
+    if (!initSearchState(state, board)) {
+        return false;
+    }
+    if (!eliminateCandidates(state, cell, digitBit(k)) || !propagate(state)) {
+        return false;
+    }
+    NoStats stats;
+    return solveBoardEfficientSearch(state, stats, 0);
+}
+
+
+// ========================= Solution Counting ==========================
+
+// Splits the search tree breadth-first on MRV cells until there are about `target` subtrees.
+// Every returned board is propagated; complete boards are solutions and are kept as they are.
+static vector<Board> splitSearchTree(const Board& board, const size_t& target) {
+    vector<Board> frontier{board};
+    SearchState state;
+
+    for (int depth = 0; depth < 8 && frontier.size() < target; depth++) {
+        vector<Board> next;
+        bool split = false;
+        for (const Board& node : frontier) {
+            if (!initSearchState(state, node) || !propagate(state)) continue;
+
+            const int cell = selectCell(state);
+            if (cell == -1) {
+                next.push_back(state.board);
+                continue;
+            }
+            split = true;
+            for (uint16_t candidates = state.candidates[cell]; candidates; candidates &= candidates - 1) {
+                const int mark = state.trailSize;
+                if (assignDigit(state, cell, lowestDigit(candidates)) && propagate(state)) {
+                    next.push_back(state.board);
+                }
+                undoTrail(state, mark);
             }
-            
-            
-            BOARD[row][col] = 0;
         }
+        frontier.swap(next);
+        if (!split) break;
     }
-    
-    
-    return false;
+    return frontier;
+}
+
+// Runs task(state) on the propagated search state of every subtree, one subtree per parallelFor index
+template <typename SubtreeTask>
+static void forEachSubtree(const Board& board, const int& num_threads, const atomic<bool>& stop, const SubtreeTask& task) {
+    const int threads = resolveThreadCount(num_threads);
+    const vector<Board> subtrees = (threads == 1) ? vector<Board>{board}
+                                                  : splitSearchTree(board, static_cast<size_t>(threads) * 16);
+
+    parallelFor(static_cast<int>(subtrees.size()), threads, [&](int i) {
+        if (stop.load(memory_order_relaxed)) return;
+        SearchState state;
+        if (!initSearchState(state, subtrees[i]) || !propagate(state)) return;
+        task(state);
+    });
+}
+
+uint64_t countSolutions(const Board& board, const uint64_t& limit, const int& num_threads) {
+    const uint64_t cap = (limit == 0) ? UINT64_MAX : limit;
+    atomic<uint64_t> total{0};
+    atomic<bool> stop{false};
+
+    // Subtrees count locally and publish in chunks, so threads rarely write the shared counter
+    constexpr uint64_t PUBLISH_EVERY = 4096;
+    auto publish = [&](uint64_t& pending) {
+        if (total.fetch_add(pending, memory_order_relaxed) + pending >= cap) stop = true;
+        pending = 0;
+    };
+
+    forEachSubtree(board, num_threads, stop, [&](SearchState& state) {
+        uint64_t pending = 0;
+        auto onSolution = [&](const Board&) {
+            if (++pending == PUBLISH_EVERY || total.load(memory_order_relaxed) + pending >= cap) publish(pending);
+            return !stop.load(memory_order_relaxed);
+        };
+        enumerateSolutionsSearch(state, onSolution);
+        publish(pending);
+    });
+    return min(total.load(), cap);
 }
 
+uint64_t countSolutions(int** BOARD, const uint64_t& limit, const int& num_threads) {
+    return countSolutions(boardFromLegacy(BOARD), limit, num_threads);
+}
+
+uint64_t enumerateSolutions(const Board& board, const function<void(const Board&)>& callback,
+                            const uint64_t& limit, const int& num_threads) {
+    const uint64_t cap = (limit == 0) ? UINT64_MAX : limit;
+    uint64_t delivered = 0;
+    mutex callbackMutex;
+    atomic<bool> stop{false};
+
+    forEachSubtree(board, num_threads, stop, [&](SearchState& state) {
+        auto onSolution = [&](const Board& solution) {
+            if (stop.load(memory_order_relaxed)) return false;
+            lock_guard<mutex> lock(callbackMutex);
+            if (delivered == cap) return false;  // Another subtree reached the limit first
+            callback(solution);
+            if (++delivered == cap) stop = true;
+            return delivered < cap;
+        };
+        enumerateSolutionsSearch(state, onSolution);
+    });
+    return delivered;
+}
+
+// ========================= Parallel Solving ==========================
+
+namespace {
+
+// Guesses a leaf subtree makes between two looks at the best solution found so far
+constexpr uint64_t PARALLEL_SLICE_NODES = 256;
+
+// A subtree's position holds the child index (< 16) taken at every forked level, first level in the top bits
+constexpr int ORDER_BITS = 4;
+constexpr int MAX_FORK_DEPTH = 15;
+
+struct ParallelSolve {
+    ThreadPool& pool;
+    int forkDepth;
+    atomic<uint64_t> bestOrder{UINT64_MAX};   // Position of the leftmost subtree that found a solution
+    mutex solutionMutex;
+    Board solution;
+    // Tasks of this solve still queued or running; the pool may be running other work too
+    int pending = 0;
+    mutex pendingMutex;
+    condition_variable allDone;
+    exception_ptr error;   // First exception a subtree threw (pendingMutex)
+
+    ParallelSolve(ThreadPool& pool, const int& forkDepth) : pool(pool), forkDepth(forkDepth) {}
+
+    void fork(const Board& board, const int& depth, const uint64_t& order) {
+        {
+            lock_guard<mutex> lock(pendingMutex);
+            pending++;
+        }
+        pool.submit([this, board, depth, order]() {
+            exception_ptr thrown;
+            try {
+                search(board, depth, order);
+            } catch (...) {
+                thrown = current_exception();
+            }
+            // Notified under the lock, so wait() cannot return and destroy this object before we are done with it
+            lock_guard<mutex> lock(pendingMutex);
+            if (thrown && !error) error = thrown;
+            if (--pending == 0) allDone.notify_all();
+        });
+    }
+
+    void wait() {
+        unique_lock<mutex> lock(pendingMutex);
+        allDone.wait(lock, [this]() { return pending == 0; });
+        if (error) rethrow_exception(error);
+    }
+
+    void found(const Board& board, const uint64_t& order) {
+        lock_guard<mutex> lock(solutionMutex);
+        if (order < bestOrder.load(memory_order_relaxed)) {
+            solution = board;
+            bestOrder.store(order, memory_order_relaxed);
+        }
+    }
+
+    // True once a subtree visited earlier by the sequential search has a solution
+    bool superseded(const uint64_t& order) const {
+        return bestOrder.load(memory_order_relaxed) < order;
+    }
+
+    void search(const Board& board, const int& depth, const uint64_t& order) {
+        if (superseded(order)) return;
+
+        if (depth < forkDepth) {
+            SearchState state;
+            if (!initSearchState(state, board) || !propagate(state)) return;
+            const int cell = selectCell(state);
+            if (cell == -1) {
+                found(state.board, order);
+                return;
+            }
+
+            Board children[9];
+            bool viable[9];
+            int count = 0;
+            for (uint16_t candidates = state.candidates[cell]; candidates; candidates &= candidates - 1, count++) {
+                const int mark = state.trailSize;
+                viable[count] = assignDigit(state, cell, lowestDigit(candidates)) && propagate(state);
+                if (viable[count]) children[count] = state.board;
+                undoTrail(state, mark);
+            }
+
+            // Pushed last to first, so this worker continues with the leftmost child and thieves take the others
+            const int shift = ORDER_BITS * (MAX_FORK_DEPTH - 1 - depth);
+            for (int i = count - 1; i >= 0; i--) {
+                if (!viable[i]) continue;
+                fork(children[i], depth + 1, order | (static_cast<uint64_t>(i) << shift));
+            }
+            return;
+        }
+
+        ResumableSolver solver(board);
+        SolveBudget budget;
+        budget.maxNodes = PARALLEL_SLICE_NODES;
+        SolveStatus status;
+        while ((status = solver.run(budget)) == SolveStatus::BudgetExceeded) {
+            if (superseded(order)) return;
+        }
+        if (status == SolveStatus::Solved) found(solver.solution(), order);
+    }
+};
+
+} // namespace
+
+bool solveBoardParallel(Board& board, ThreadPool& pool) {
+    const int threads = pool.size();
+    if (threads == 1) return solveBoardEfficient(board);
+
+    // With two candidates per level, 2^forkDepth subtrees: at least 4 per worker
+    int forkDepth = 2;
+    while ((1 << forkDepth) < threads * 4 && forkDepth < MAX_FORK_DEPTH) forkDepth++;
+
+    ParallelSolve solve(pool, forkDepth);
+    solve.fork(board, 0, 0);
+    solve.wait();
+
+    if (solve.bestOrder.load() == UINT64_MAX) return false;
+    board = solve.solution;
+    return true;
+}
+
+bool solveBoardParallel(Board& board, const int& num_threads) {
+    const int threads = resolveThreadCount(num_threads);
+    if (threads == 1) return solveBoardEfficient(board);
+    ThreadPool pool(threads);
+    return solveBoardParallel(board, pool);
+}
+
+// ========================= Solver Selection ==========================
+
+const char* getSolverName(const SolverType& solver) {
+    switch (solver) {
+        case SolverType::Efficient:    return "efficientSolveBoard";
+        case SolverType::DancingLinks: return "dancingLinksSolveBoard";
+        default:                       return "solveBoard";
+    }
+}
+
+bool solve(Board& board, const SolverType& solver) {
+    switch (solver) {
+        case SolverType::Efficient:    return solveBoardEfficient(board);
+        case SolverType::DancingLinks: return solveBoardDancingLinks(board);
+        default:                       return solveBoard(board, 0, 0);
+    }
+}
+
+bool solve(Board& board, const SolverType& solver, SolverStats& stats) {
+    switch (solver) {
+        case SolverType::Efficient:    return solveBoardEfficient(board, stats);
+        case SolverType::DancingLinks: return solveBoardDancingLinks(board, stats);
+        default:                       return solveBoard(board, stats);
+    }
+}
+
+bool solve(int** board, const SolverType& solver) {
+    Board copy = boardFromLegacy(board);
+    if (!solve(copy, solver)) {
+        return false;
+    }
+    copyBoardToLegacy(copy, board);
+    return true;
+}
+
+bool solve(Board& board, const bool& efficient) {
+    return solve(board, efficient ? SolverType::Efficient : SolverType::Backtracking);
+}
 
 bool solve(int** board, const bool& efficient) {
     // TODO: Implement logic to select the appropriate solver based on the 'efficient' flag
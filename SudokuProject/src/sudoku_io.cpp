@@ -9,26 +9,34 @@
 #include <regex>
 #include <chrono>
 #include <iomanip>  // For formatted output
+#include <algorithm>
+#include <atomic>
+#include <mutex>
 
 #include "../include/generator.h"
 #include "../include/sudoku_io.h"
 #include "../include/utils.h"
 #include "../include/sudoku.h"
+#include "../include/board.h"
+#include "../include/solver_engine.h"
+#include "../include/thread_pool.h"
+#include "../include/rng.h"
+#include "../include/board_format.h"
 
 using namespace std;
 using namespace std::chrono;
 
-void printBoard(int** BOARD, const int& r, const int& c, int k, const bool& color)
+void printBoard(const Board& BOARD, const int& r, const int& c, int k, const bool& color)
 {
-    if(BOARD[r][c]>0) k = 0;
+    if(BOARD.at(r, c)>0) k = 0;
 
     for (int i = 0; i < 9; i++)
     {
         for (int j = 0; j < 9; j++)
         {
             string board_piece;
-            if (BOARD[i][j] == 0) board_piece = color ? "\x1B[93m-\x1B[0m" : " "; // Yellow
-            else board_piece = to_string(BOARD[i][j]); // White
+            if (BOARD.at(i, j) == 0) board_piece = color ? "\x1B[93m-\x1B[0m" : " "; // Yellow
+            else board_piece = to_string(BOARD.at(i, j)); // White
             if ((i == r && j == c) && k != 0)
             {
                 if (isValid(BOARD, r, c, k))
@@ -49,40 +57,38 @@ void printBoard(int** BOARD, const int& r, const int& c, int k, const bool& colo
     }
 }
 
-void boardToString(int** BOARD, string &content){
-    for(int i = 0; i < 9; i++){
-        for(int j = 0; j < 9; j++){
-            string board_piece;
-
-            if (BOARD[i][j] == 0) content += "-";
-            else content += to_string(BOARD[i][j]);
+void printBoard(int** BOARD, const int& r, const int& c, int k, const bool& color)
+{
+    printBoard(boardFromLegacy(BOARD), r, c, k, color);
+}
 
-            if (j == 2 || j == 5)  content += " | ";
-            else content += " ";
-        }
-        if (i == 2 || i == 5)
-        {
-            content += "\n";
-            for (int l = 0; l < 21; l++) content += ".";
-        }
-        content += "\n";
-    }
+void boardToString(const Board& BOARD, string &content){
+    char text[PRETTY_BOARD_SIZE];
+    content.append(text, formatBoard(BOARD, text));
 }
 
-bool writeSudokuToFile(int** BOARD, const string& filename) {
-    string content;
-    boardToString(BOARD, content);
-    ofstream outFile(filename); // Open file for writing
+bool writeSudokuToFile(const Board& BOARD, const string& filename, const bool& verbose) {
+    char text[PRETTY_BOARD_SIZE];
+    const int length = formatBoard(BOARD, text);
+    ofstream outFile(filename, ios::binary); // Open file for writing
     if (outFile.is_open()) {
-        outFile << content; // Write content to file
+        outFile.write(text, length); // Write content to file
         outFile.close(); // Close the file
-        cout << "Content has been written to the file: " << filename << endl;
+        if (verbose) cout << "Content has been written to the file: " << filename << endl;
         return true;
     }
     cerr << "Unable to open file: " << filename << endl;
     return false;
 }
 
+void boardToString(int** BOARD, string &content){
+    boardToString(boardFromLegacy(BOARD), content);
+}
+
+bool writeSudokuToFile(int** BOARD, const string& filename, const bool& verbose) {
+    return writeSudokuToFile(boardFromLegacy(BOARD), filename, verbose);
+}
+
 void replaceCharacter(std::string& str, char oldChar, char newChar) {
     for (char &ch: str) {
         if (ch == oldChar) {
@@ -102,45 +108,148 @@ void extractNumbers(const string& input, vector<int>& numbers) {
     }
 }
 
+void fillBoard(const vector<int>& numbers, Board& BOARD){
+    for(int i = 0; i < 81; i++) {
+        BOARD[i] = (i < static_cast<int>(numbers.size())) ? static_cast<uint8_t>(numbers[i]) : 0;
+    }
+}
+
 void fillBoard(const vector<int>& numbers, int **BOARD){
     for(int i = 0; i < 9; i++) {
         BOARD[i] = new int[9];
         for(int j = 0; j < 9; j++){
-            BOARD[i][j] = numbers[i * 9 + j];
+            const int index = i * 9 + j;
+            BOARD[i][j] = (index < static_cast<int>(numbers.size())) ? numbers[index] : 0;
         }
     }
 }
 
-int** readSudokuFromFile(const string& filename){
-    int** BOARD = new int*[9];
-    vector<int> numbers;
-
-    ifstream file(filename);
-    string sudoku = string(istreambuf_iterator<char>(file), istreambuf_iterator<char>());
+const char* getParseErrorMessage(const ParseError& error) {
+    switch (error) {
+        case ParseError::InvalidCharacter:    return "invalid character";
+        case ParseError::TooFewCells:         return "fewer than 81 cells";
+        case ParseError::TooManyCells:        return "more than 81 cells";
+        case ParseError::ContradictoryGivens: return "digit repeated in a row, column or box";
+        case ParseError::FileError:           return "file cannot be read";
+        default:                              return "no error";
+    }
+}
 
-    replaceCharacter(sudoku, '-', '0');
-    extractNumbers(sudoku, numbers);
-    fillBoard(numbers, BOARD);
-    return BOARD;
+// Converts a character offset into a 1-based line/column status
+static ParseStatus parseErrorAt(const char* text, const size_t& offset, const ParseError& error) {
+    ParseStatus status;
+    status.error = error;
+    status.line = 1;
+    status.column = 1;
+    for (size_t i = 0; i < offset; i++) {
+        if (text[i] == '\n') { status.line++; status.column = 1; }
+        else status.column++;
+    }
+    return status;
 }
 
-bool checkIfSolutionIsValid(int** BOARD){
-    for(int r = 0; r < 9; r++) {
-        for(int c = 0; c < 9; c++) {
-            int k = BOARD[r][c];
-            BOARD[r][c] = 0;
-            if(!isValid(BOARD, r, c, k)){
-                BOARD[r][c] = k;
-                // cout << "!!!!!!!!!!!!!!!! TEST FAILED !!!!!!!!!!!!!!!!" << endl;
-                return false;
+ParseStatus parseBoard(const char* text, const size_t& length, Board& BOARD) {
+    uint32_t cellOffset[81];  // Where each cell was read, to locate contradictions
+    int cells = 0;
+
+    size_t lineStart = 0;
+    while (lineStart < length) {
+        size_t lineEnd = lineStart;
+        while (lineEnd < length && text[lineEnd] != '\n') lineEnd++;
+
+        // First pass: validate the characters, count the cells and check whether the line is drawn
+        // only with '-', '.' and '+', the characters of a separator line
+        int blanks = 0;
+        bool drawn = true, crossed = false;
+        for (size_t i = lineStart; i < lineEnd; i++) {
+            const char ch = text[i];
+            if (ch == '.' || ch == '-') blanks++;
+            else if (ch == '+') crossed = true;
+            else if ((ch >= '0' && ch <= '9') || ch == '|' || ch == ',') drawn = false;
+            else if (ch != ' ' && ch != '\t' && ch != '\r') {
+                return parseErrorAt(text, i, ParseError::InvalidCharacter);
             }
-            BOARD[r][c] = k;
+        }
+
+        // Second pass: store the cells unless this is a separator line (a drawn line with a '+',
+        // or one whose length is not that of a 9- or 81-cell row)
+        const bool separator = drawn && blanks > 0 && (crossed || (blanks != 9 && blanks != 81));
+        for (size_t i = lineStart; i < lineEnd && !separator; i++) {
+            const char ch = text[i];
+            const bool given = ch >= '1' && ch <= '9';
+            if (!given && ch != '0' && ch != '.' && ch != '-') continue;
+            if (cells == 81) return parseErrorAt(text, i, ParseError::TooManyCells);
+            cellOffset[cells] = static_cast<uint32_t>(i);
+            BOARD[cells++] = given ? static_cast<uint8_t>(ch - '0') : 0;
+        }
+        lineStart = lineEnd + 1;
+    }
+
+    if (cells < 81) return parseErrorAt(text, length, ParseError::TooFewCells);
+
+    // Replay the givens in reading order to find the first one that repeats a digit
+    CandidateMasks masks{};
+    for (int i = 0; i < 81; i++) {
+        const int k = BOARD[i];
+        if (k == 0) continue;
+        if (!(getCandidates(masks, i / 9, i % 9) & digitBit(k))) {
+            return parseErrorAt(text, cellOffset[i], ParseError::ContradictoryGivens);
+        }
+        placeDigit(masks, i / 9, i % 9, k);
+    }
+    return ParseStatus();
+}
+
+bool readSudokuFromFile(const string& filename, Board& BOARD){
+    // Puzzle files are a few hundred bytes; anything larger than the buffer is rejected
+    char buffer[4096];
+
+    ifstream file(filename, ios::binary);
+    if (!file.is_open()) {
+        cerr << "Unable to open file: " << filename << endl;
+        return false;
+    }
+    file.read(buffer, sizeof(buffer));
+    const size_t length = static_cast<size_t>(file.gcount());
+    if (length == sizeof(buffer) && file.peek() != char_traits<char>::eof()) {
+        cerr << "Invalid Sudoku in file: " << filename << " (" << getParseErrorMessage(ParseError::FileError) << ")" << endl;
+        return false;
+    }
+
+    const ParseStatus status = parseBoard(buffer, length, BOARD);
+    if (!status.ok()) {
+        cerr << "Invalid Sudoku in file: " << filename << " (line " << status.line << ", column " << status.column
+             << ": " << getParseErrorMessage(status.error) << ")" << endl;
+        return false;
+    }
+    return true;
+}
+
+int** readSudokuFromFile(const string& filename){
+    Board board;
+    if (!readSudokuFromFile(filename, board)) {
+        return nullptr;
+    }
+    return boardToLegacy(board);
+}
+
+bool checkIfSolutionIsValid(const Board& BOARD){
+    CandidateMasks masks;
+    if (!initCandidateMasks(BOARD, masks)) {
+        return false;  // Some row, column or box repeats a digit
+    }
+    for (int i = 0; i < 81; i++) {
+        if (BOARD[i] == 0) {
+            return false;  // Not completely filled
         }
     }
-    // cout << "--------------- TEST PASSED ---------------" << endl;
     return true;
 }
 
+bool checkIfSolutionIsValid(int** BOARD){
+    return checkIfSolutionIsValid(boardFromLegacy(BOARD));
+}
+
 vector<string> getAllSudokuInFolder(const string& folderPath){
     vector<std::string> sudokus;
     for (const auto& entry : filesystem::directory_iterator(folderPath)) {
@@ -148,6 +257,8 @@ vector<string> getAllSudokuInFolder(const string& folderPath){
             sudokus.push_back(entry.path().string());
         }
     }
+    // Directory order is unspecified; sorting keeps puzzle i mapped to solution i
+    sort(sudokus.begin(), sudokus.end());
     cout << sudokus.size() << " Sudoku Puzzle found @ " << folderPath << endl;
     cout << setfill('-') << setw(55)<< "" << setfill(' ') <<endl;
     cout << setw(5) << "Index" << setw(50) << "File Name" << endl;
@@ -158,7 +269,7 @@ vector<string> getAllSudokuInFolder(const string& folderPath){
     return sudokus;
 }
 
-void createAndSaveNPuzzles(const int& num_puzzles, const int& complexity_empty_boxes, const string& destination, const string& prefix){
+void createAndSaveNPuzzles(const int& num_puzzles, const int& complexity_empty_boxes, const string& destination, const string& prefix, const int& num_threads, const uint64_t& seed, const bool& unique, const bool& verbose){
     /**
      * TODO:
      * - Identify where in this function dynamically allocated memory (e.g., Sudoku boards) should be deallocated.
@@ -175,18 +286,32 @@ void createAndSaveNPuzzles(const int& num_puzzles, const int& complexity_empty_b
      * - Be mindful of potential memory leaks if the board isn't deallocated properly.
      * - Set the pointer to nullptr after deallocation to avoid dangling pointers.
      */
-    int total_success = 0;
-    for(int i=0; i < num_puzzles; i++){
-        int** BOARD = generateBoard(complexity_empty_boxes);
+    uint64_t base_seed = seed;
+    if (base_seed == 0) {
+        base_seed = threadRng().next();
+    }
+    cout << "Generating " << num_puzzles << " puzzles with seed " << base_seed << endl;
+
+    // Per-file messages only make sense when a single thread writes in order
+    const bool per_file = verbose && resolveThreadCount(num_threads) == 1;
+    atomic<int> total_success{0};
+
+    parallelFor(num_puzzles, num_threads, [&](int i) {
+        // Puzzle i depends only on (seed, i), never on which thread generates it
+        thread_local Rng rng;
+        rng.reseed(base_seed, static_cast<uint64_t>(i));
+
+        Board BOARD;
+        if (unique) generateUniqueBoard(BOARD, complexity_empty_boxes, rng);
+        else generateBoard(BOARD, complexity_empty_boxes, rng);
         string filename = getFileName(i, destination, prefix);
-        if(writeSudokuToFile(BOARD, filename)){
-            total_success++;
-            cout << "Successfully written(" << filename << ") "<< total_success << "of " << num_puzzles << endl;
+        if(writeSudokuToFile(BOARD, filename, per_file)){
+            int written = ++total_success;
+            if (per_file) cout << "Successfully written(" << filename << ") "<< written << "of " << num_puzzles << endl;
         }else{
             cout << "!! Failed to write(" << filename << ") "<< total_success << "of " << num_puzzles << endl;
         }
-        deallocateBoard(BOARD,9);
-    }
+    });
     cout << total_success << " files written out of " << num_puzzles <<endl;
 }
 
@@ -206,7 +331,18 @@ void displayProgressBar(int current, int total, int barWidth = 50) {
     cout.flush();
 }
 
-void solveAndSaveNPuzzles(const int &num_puzzles, const string& source, const string& destination, const string& prefix){
+void printSolverStats(const string& name, const SolverStats& stats) {
+    const double puzzles = stats.puzzles ? static_cast<double>(stats.puzzles) : 1.0;
+    cout << name << " search per puzzle: " << fixed << setprecision(1)
+         << stats.nodes / puzzles << " nodes, "
+         << stats.backtracks / puzzles << " backtracks, "
+         << stats.candidateChecks / puzzles << " candidate checks, "
+         << stats.propagations / puzzles << " propagations, "
+         << setprecision(3) << stats.selectionNanos / puzzles / 1000.0 << " us selecting cells"
+         << " | max depth " << stats.maxDepth << " over " << stats.puzzles << " puzzles" << endl;
+}
+
+void solveAndSaveNPuzzles(const int &num_puzzles, const string& source, const string& destination, const string& prefix, const int& num_threads, const bool& verbose, const SolverType& solver, const bool& collect_stats){
     /**
       * TODO:
       * - Identify where in this function dynamically allocated memory (e.g., Sudoku boards) should be deallocated.
@@ -228,22 +364,74 @@ void solveAndSaveNPuzzles(const int &num_puzzles, const string& source, const st
     vector<string> path_to_sudokus = getAllSudokuInFolder(source);
 
     cout << "Number of loaded puzzles:" << path_to_sudokus.size() << "/" << num_puzzles << endl;
+
+    if (resolveThreadCount(num_threads) > 1) {
+        // Thread-pool mode: puzzle i is always written as solution i, whichever worker handles it
+        atomic<int> solved_count{0};
+        atomic<int> written_count{0};
+        SolverStats stats;
+        mutex stats_mutex;
+        const int total = static_cast<int>(path_to_sudokus.size());
+        parallelFor(total, num_threads, [&](int i) {
+            Board puzzle;
+            if (!readSudokuFromFile(path_to_sudokus[i], puzzle)) return;
+            bool solved;
+            if (collect_stats) {
+                SolverStats puzzle_stats;
+                solved = solve(puzzle, solver, puzzle_stats);
+                lock_guard<mutex> lock(stats_mutex);
+                stats += puzzle_stats;
+            } else {
+                solved = solve(puzzle, solver);
+            }
+            if (solved && checkIfSolutionIsValid(puzzle)) {
+                solved_count++;
+                if (writeSudokuToFile(puzzle, getFileName(i, destination, prefix), false)) {
+                    written_count++;
+                }
+            }
+        });
+        cout << "Puzzle Solved(over available): " << solved_count << "/" << total << " | ";
+        cout << "Puzzle Solved(over total): " << solved_count << "/" << num_puzzles << endl;
+        cout << "Puzzle Solved Written(over available): " << written_count << "/" << total << " | ";
+        cout << "Puzzle Solved Written(over total): " << written_count << "/" << num_puzzles << endl;
+        if (collect_stats) printSolverStats(getSolverName(solver), stats);
+        return;
+    }
+
+    Board sudoku;
+    SolverStats stats;
     for(int i = 0; i < path_to_sudokus.size(); i++){
-        int** sudoku = readSudokuFromFile(path_to_sudokus[i]);
-        if(solve(sudoku)){
+        if(!readSudokuFromFile(path_to_sudokus[i], sudoku)){
+            continue;
+        }
+        // The plain overload keeps the uninstrumented solver when no counters are wanted
+        if(collect_stats ? solve(sudoku, solver, stats) : solve(sudoku, solver)){
             if(checkIfSolutionIsValid(sudoku)){
                 total_success_solve++;
                 string filename = getFileName(i, destination, prefix);
-                cout << "Puzzle Solved(over available): " << total_success_solve << "/" << path_to_sudokus.size() << " | ";
-                cout << "Puzzle Solved(over total): " << total_success_solve << "/" << num_puzzles << endl;
-                if(writeSudokuToFile(sudoku, filename)){
+                if (verbose) {
+                    cout << "Puzzle Solved(over available): " << total_success_solve << "/" << path_to_sudokus.size() << " | ";
+                    cout << "Puzzle Solved(over total): " << total_success_solve << "/" << num_puzzles << endl;
+                }
+                if(writeSudokuToFile(sudoku, filename, verbose)){
                     total_success_write++;
                 }
-                cout << "Puzzle Solved Written(over available): " << total_success_write << "/" << path_to_sudokus.size() << " | ";
-                cout << "Puzzle Solved Written(over total): " << total_success_write << "/" << num_puzzles << endl;
+                if (verbose) {
+                    cout << "Puzzle Solved Written(over available): " << total_success_write << "/" << path_to_sudokus.size() << " | ";
+                    cout << "Puzzle Solved Written(over total): " << total_success_write << "/" << num_puzzles << endl;
+                }
             }
         }
-        deallocateBoard(sudoku,9);
+    }
+    if (!verbose) {
+        cout << "Puzzle Solved(over available): " << total_success_solve << "/" << path_to_sudokus.size() << " | ";
+        cout << "Puzzle Solved(over total): " << total_success_solve << "/" << num_puzzles << endl;
+        cout << "Puzzle Solved Written(over available): " << total_success_write << "/" << path_to_sudokus.size() << " | ";
+        cout << "Puzzle Solved Written(over total): " << total_success_write << "/" << num_puzzles << endl;
+    }
+    if (collect_stats) {
+        printSolverStats(getSolverName(solver), stats);
     }
 }
 
@@ -268,7 +456,7 @@ int** deepCopyBoard(int** original) {
     return newBoard;
 }
 
-void compareSudokuSolvers(const int& experiment_size, const int& empty_boxes) {
+void compareSudokuSolvers(const int& experiment_size, const int& empty_boxes, const bool& collect_stats) {
     /**
      * TODO:
      * - Identify where in this function dynamically allocated memory (e.g., Sudoku boards) should be deallocated.
@@ -287,24 +475,39 @@ void compareSudokuSolvers(const int& experiment_size, const int& empty_boxes) {
      */
     double totalTimeSolveBoard = 0.0;
     double totalTimeEfficientSolveBoard = 0.0;
+    double totalTimeDancingLinks = 0.0;
 
     int validSolutionsSolveBoard = 0;
     int validSolutionsEfficientSolveBoard = 0;
+    int validSolutionsDancingLinks = 0;
 
-    int** board1 = nullptr;
-    int** board2 = nullptr;
+    Board board1;
+    Board board2;
+    Board board3;
     bool solved = false;
 
+    // Counters come from a separate instrumented solve, so they do not skew the timings
+    SolverStats statsSolveBoard;
+    SolverStats statsEfficientSolveBoard;
+    SolverStats statsDancingLinks;
+    Board instrumented;
+
     cout << "Running Sudoku Solver Comparisons...\n";
 
     for (int i = 1; i <= experiment_size; ++i) {
-        // Generate a single board and deep copy
-        board1 = generateBoard(empty_boxes);  // Fresh board for efficient solver
-        if (!board1) {
-            cerr << "Failed to generate board.\n";
-            continue;
+        // Generate a single board and copy it by value
+        generateBoard(board1, empty_boxes);  // Fresh board for efficient solver
+        board2 = board1;                     // Copy for regular solver
+        board3 = board1;                     // Copy for Dancing Links solver
+
+        if (collect_stats) {
+            instrumented = board1;
+            solve(instrumented, SolverType::Efficient, statsEfficientSolveBoard);
+            instrumented = board1;
+            solve(instrumented, SolverType::Backtracking, statsSolveBoard);
+            instrumented = board1;
+            solve(instrumented, SolverType::DancingLinks, statsDancingLinks);
         }
-        board2 = deepCopyBoard(board1);       // Deep copy for regular solver
 
         // -------------------- Testing solveBoardEfficient --------------------
         auto startEfficient = high_resolution_clock::now();
@@ -337,11 +540,23 @@ void compareSudokuSolvers(const int& experiment_size, const int& empty_boxes) {
             cerr << "solveBoard produced an invalid solution.\n";
         }
 
+        // -------------------- Testing solveBoardDancingLinks --------------------
+        auto startDancingLinks = high_resolution_clock::now();
+        solved = solve(board3, SolverType::DancingLinks);  // Solve using exact cover
+        auto endDancingLinks = high_resolution_clock::now();
+
+        double elapsedDancingLinks = duration<double>(endDancingLinks - startDancingLinks).count();
+        totalTimeDancingLinks += elapsedDancingLinks;
+
+        // Validate solution
+        if (solved && checkIfSolutionIsValid(board3)) {
+            validSolutionsDancingLinks++;
+        } else {
+            cerr << "solveBoardDancingLinks produced an invalid solution.\n";
+        }
+
         // -------------------- Progress Bar Update --------------------
         displayProgressBar(i, experiment_size);
-
-        deallocateBoard(board1,9);
-        deallocateBoard(board2,9);
     }
 
     cout << endl;  // Move to the next line after progress bar is done.
@@ -354,12 +569,21 @@ void compareSudokuSolvers(const int& experiment_size, const int& empty_boxes) {
     cout << "solveBoard average time: " << fixed << setprecision(4)
          << 1000 * (totalTimeSolveBoard / experiment_size) << " milliseconds" << endl;
     cout << "solveBoard valid solutions: " << validSolutionsSolveBoard << "/" << experiment_size << endl;
+    if (collect_stats) printSolverStats("solveBoard", statsSolveBoard);
 
     cout << "-------------------------------------------------------------" << endl;
 
     cout << "efficientSolveBoard average time: " << fixed << setprecision(4)
          << 1000 * (totalTimeEfficientSolveBoard / experiment_size) << " milliseconds" << endl;
     cout << "efficientSolveBoard valid solutions: " << validSolutionsEfficientSolveBoard << "/" << experiment_size << endl;
+    if (collect_stats) printSolverStats("efficientSolveBoard", statsEfficientSolveBoard);
+
+    cout << "-------------------------------------------------------------" << endl;
+
+    cout << "dancingLinksSolveBoard average time: " << fixed << setprecision(4)
+         << 1000 * (totalTimeDancingLinks / experiment_size) << " milliseconds" << endl;
+    cout << "dancingLinksSolveBoard valid solutions: " << validSolutionsDancingLinks << "/" << experiment_size << endl;
+    if (collect_stats) printSolverStats("dancingLinksSolveBoard", statsDancingLinks);
 
     cout << "===========================================================================" << endl;
 }
@@ -0,0 +1,159 @@
+/**
+ * @file thread_pool.cpp
+ * @brief Implementation of the work-stealing thread pool.
+ *
+ * Detailed function descriptions are provided in the corresponding header file.
+ *
+ * @author
+ * Keshav Bhandari
+ *
+ * @date
+ * October 16, 2026
+ */
+
+#include "../include/thread_pool.h"
+
+using namespace std;
+
+// Identity of the calling thread when it is a pool worker
+static thread_local const ThreadPool* tlsPool = nullptr;
+static thread_local int tlsWorker = -1;
+
+int resolveThreadCount(const int& requested) {
+    if (requested > 0) return requested;
+    const unsigned hardware = thread::hardware_concurrency();
+    return hardware > 0 ? static_cast<int>(hardware) : 1;
+}
+
+ThreadPool::ThreadPool(const int& workerCount) {
+    const int count = resolveThreadCount(workerCount);
+    for (int i = 0; i < count; i++) {
+        queues.push_back(make_unique<WorkerQueue>());
+    }
+    for (int i = 0; i < count; i++) {
+        workers.emplace_back(&ThreadPool::workerLoop, this, i);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    // A failure nobody waited for is dropped: a destructor must not throw
+    waitIdle();
+    {
+        lock_guard<mutex> lock(stateMutex);
+        stopping = true;
+    }
+    taskAvailable.notify_all();
+    for (thread& worker : workers) {
+        worker.join();
+    }
+}
+
+int ThreadPool::currentWorker() {
+    return tlsWorker;
+}
+
+void ThreadPool::submit(function<void()> task) {
+    if (tlsPool == this && tlsWorker >= 0) {
+        submitTo(move(task), tlsWorker);
+    } else {
+        submitTo(move(task), static_cast<int>(nextQueue++ % queues.size()));
+    }
+}
+
+void ThreadPool::submitTo(function<void()> task, const int& worker) {
+    unfinished++;
+    {
+        WorkerQueue& queue = *queues[worker % queues.size()];
+        lock_guard<mutex> lock(queue.mutex);
+        queue.tasks.push_back(move(task));
+    }
+    queued++;
+
+    // Taking the state lock orders this push before a worker's sleep check
+    { lock_guard<mutex> lock(stateMutex); }
+    taskAvailable.notify_one();
+}
+
+void ThreadPool::wait() {
+    exception_ptr error = waitIdle();
+    if (error) rethrow_exception(error);
+}
+
+exception_ptr ThreadPool::waitIdle() {
+    unique_lock<mutex> lock(stateMutex);
+    allDone.wait(lock, [this] { return unfinished == 0; });
+    exception_ptr error = firstError;
+    firstError = nullptr;
+    return error;
+}
+
+bool ThreadPool::popTask(const int& index, function<void()>& task) {
+    // Own deque first, newest task first
+    {
+        WorkerQueue& own = *queues[index];
+        lock_guard<mutex> lock(own.mutex);
+        if (!own.tasks.empty()) {
+            task = move(own.tasks.back());
+            own.tasks.pop_back();
+            queued--;
+            return true;
+        }
+    }
+
+    // Steal the oldest task of another worker
+    const int count = static_cast<int>(queues.size());
+    for (int offset = 1; offset < count; offset++) {
+        WorkerQueue& victim = *queues[(index + offset) % count];
+        lock_guard<mutex> lock(victim.mutex);
+        if (!victim.tasks.empty()) {
+            task = move(victim.tasks.front());
+            victim.tasks.pop_front();
+            queued--;
+            return true;
+        }
+    }
+    return false;
+}
+
+void ThreadPool::workerLoop(const int& index) {
+    tlsPool = this;
+    tlsWorker = index;
+
+    for (;;) {
+        function<void()> task;
+        if (popTask(index, task)) {
+            try {
+                task();
+            } catch (...) {
+                // Kept for wait(); the worker and the other tasks carry on
+                lock_guard<mutex> lock(stateMutex);
+                if (!firstError) firstError = current_exception();
+            }
+            if (--unfinished == 0) {
+                lock_guard<mutex> lock(stateMutex);
+                allDone.notify_all();
+            }
+            continue;
+        }
+
+        unique_lock<mutex> lock(stateMutex);
+        taskAvailable.wait(lock, [this] { return stopping || queued > 0; });
+        if (stopping && queued == 0) return;
+    }
+}
+
+void parallelFor(const int& count, const int& threads, const function<void(int)>& body) {
+    const int workerCount = resolveThreadCount(threads);
+    if (workerCount == 1 || count <= 1) {
+        for (int i = 0; i < count; i++) body(i);
+        return;
+    }
+
+    ThreadPool pool(workerCount);
+    for (int i = 0; i < count; i++) {
+        // Contiguous blocks keep neighbouring indices on the same worker until stolen
+        const int owner = static_cast<int>(static_cast<long long>(i) * workerCount / count);
+        pool.submitTo([&body, i] { body(i); }, owner);
+    }
+    pool.wait();
+}
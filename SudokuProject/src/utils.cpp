@@ -48,7 +48,7 @@ void initDataFolder(){
 
 string getFileName(const int& index, const string& destination, const string& prefix){
     string index_str = to_string(index);
-    string index_fill = string(4 - index_str.length(), '0');
+    string index_fill = string(index_str.length() < 4 ? 4 - index_str.length() : 0, '0');
     string filename = destination + index_fill + index_str + prefix + ".txt";
     return filename;
 }
\ No newline at end of file